@@ -0,0 +1,453 @@
+/*
+ * @file    AVLThreadedBST.cpp
+ * @brief   A threaded binary search tree that keeps itself height-balanced by
+ *          the AVL rules. Each node records the height of its right subtree
+ *          minus the height of its left subtree. After an insertion or a
+ *          deletion, the balance of each node on the path back to the root is
+ *          adjusted, and any node whose balance reaches 2 or -2 is restored by
+ *          a single or double rotation. Rotations rewire thread pointers as
+ *          they move subtrees, so the inorder threads, and therefore the
+ *          Inorder iterator, remain valid. Search cost stays O(log n) no
+ *          matter the order in which items arrive. Being a template, this
+ *          file is included by AVLThreadedBST.h rather than compiled on its
+ *          own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _AVLTHREADEDBST_CPP
+#define	_AVLTHREADEDBST_CPP
+
+#include <cstddef>          // definition of NULL
+#include <utility>          // for move
+
+#include "AVLThreadedBST.h"
+
+using namespace std;
+
+
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>::AVLThreadedBST() :
+                                     ThreadedBST<Key, Value, Compare>()
+{
+} // end default constructor
+
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>::AVLThreadedBST(const AVLThreadedBST& orig)
+                                     throw(TreeException) :
+                                     ThreadedBST<Key, Value, Compare>(orig)
+{
+} // end copy constructor
+
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>::AVLThreadedBST(AVLThreadedBST&& orig)
+                                     throw() :
+                                     ThreadedBST<Key, Value, Compare>(
+                                                                 move(orig))
+{
+} // end move constructor
+
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>::~AVLThreadedBST()
+{
+} // end destructor
+
+/** Copies the contents of rhs into this tree.
+ * @param rhs  The right-hand tree to be copied.
+ * @pre There is sufficient memory to allocate a copy of rhs.
+ * @post This tree is a structural copy of rhs; rhs remains unchanged.
+ * @return This tree.
+ * @throw TreeException  If memory allocation fails.
+ */
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>&
+AVLThreadedBST<Key, Value, Compare>::operator=(const AVLThreadedBST& rhs)
+                                     throw(TreeException)
+{
+    ThreadedBST<Key, Value, Compare>::operator=(rhs);
+
+    return *this;
+} // end operator=(AVLThreadedBST&)
+
+/** Moves the contents of rhs into this tree.
+ * @param rhs  The right-hand tree whose nodes are taken.
+ * @pre None.
+ * @post This tree holds the items rhs held, without copying any of them; rhs
+ *       is empty.
+ * @return This tree.
+ */
+template <class Key, class Value, class Compare>
+AVLThreadedBST<Key, Value, Compare>&
+AVLThreadedBST<Key, Value, Compare>::operator=(AVLThreadedBST&& rhs)
+                                     throw()
+{
+    ThreadedBST<Key, Value, Compare>::operator=(move(rhs));
+
+    return *this;
+} // end operator=(AVLThreadedBST&&)
+
+/** Links a new node into a balanced threaded binary search tree. Both forms
+ *  of searchTreeInsert() reach this after allocating the node.
+ * @param treePtr  Pointer to the root of this tree.
+ * @param newPtr  The node to be inserted, made by allocateNode().
+ * @pre treePtr is the root of this tree; newPtr is not linked into any tree.
+ * @post The key of newPtr is in its proper order in the tree, its threads
+ *       point to its inorder predecessor and successor, and no node in the
+ *       tree has subtrees whose heights differ by more than one.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::insertItem(TreeNode *& treePtr,
+                                                     TreeNode *newPtr)
+{
+    TreeNode *path[MAXTREEHEIGHT];  // nodes from root to new leaf
+    int       dirs[MAXTREEHEIGHT];  // step taken from each node
+    TreeNode *curPtr = treePtr;
+    int       depth = 0;
+
+    if (curPtr == NULL)
+    {
+        treePtr = newPtr;
+        return;
+    } // end if (curPtr == NULL)
+
+    for (;;)    // descend until a thread marks the insertion position
+    {
+        path[depth] = curPtr;
+        ++curPtr->count;    // new node joins the subtree of curPtr
+
+        if (this->compare(newPtr->key, curPtr->key))
+        {
+            dirs[depth++] = LEFTTHREAD;
+
+            if ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD)
+            {
+                // new leaf keeps the predecessor thread; curPtr is its
+                // successor
+                this->setChildPtrs(newPtr, curPtr->leftChildPtr, curPtr);
+                curPtr->leftChildPtr = newPtr;
+                curPtr->threads -= LEFTTHREAD;
+                break;
+            } // end if ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD)
+
+            curPtr = curPtr->leftChildPtr;
+        }
+        else
+        {
+            dirs[depth++] = RIGHTTHREAD;
+
+            if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+            {
+                // new leaf keeps the successor thread; curPtr is its
+                // predecessor
+                this->setChildPtrs(newPtr, curPtr, curPtr->rightChildPtr);
+                curPtr->rightChildPtr = newPtr;
+                curPtr->threads -= RIGHTTHREAD;
+                break;
+            } // end if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+
+            curPtr = curPtr->rightChildPtr;
+        } // end if (this->compare(newPtr->key, curPtr->key))
+    } // end for (;;)
+
+    // retrace the path; each subtree grew on the side that was taken
+    while (depth-- > 0)
+    {
+        curPtr = path[depth];
+        curPtr->balance += (dirs[depth] == LEFTTHREAD ? -1 : 1);
+
+        if (curPtr->balance == 0)
+        {
+            break;      // subtree height unchanged
+        }
+        else if (curPtr->balance == 2 || curPtr->balance == -2)
+        {
+            // a rotation restores the height the subtree had before
+            rebalance(curPtr);
+            setLink(path, dirs, depth, curPtr);
+            break;
+        } // end if (curPtr->balance == 0)
+    } // end while (depth-- > 0)
+} // end insertItem(TreeNode*&, TreeNode*)
+
+/** Deletes an item with a given search key from a balanced threaded binary
+ *  search tree.
+ * @param searchKey  Key of the item to locate and remove from this tree.
+ * @pre searchKey is the search key of the item to be deleted.
+ * @post If the item whose search key equals searchKey existed in the tree, the
+ *       item is deleted and the tree is rebalanced. Otherwise, the tree is
+ *       unchanged.
+ * @throw TreeException  If searchKey is not found in the tree.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::searchTreeDelete(const Key& searchKey)
+                                         throw(TreeException)
+// Algorithm note: A node with two children takes the item of its inorder
+// successor, which is then removed instead. The node actually removed has at
+// most one child, so it is spliced out as in the unbalanced tree.
+{
+    TreeNode *path[MAXTREEHEIGHT];  // nodes from root to removed node
+    int       dirs[MAXTREEHEIGHT];  // step taken from each node
+    TreeNode *curPtr = this->rootPtr();
+    TreeNode *delPtr;
+    TreeNode *edgePtr;
+    int       depth = 0;
+
+    // locate the node that holds searchKey
+    while (curPtr != NULL)
+    {
+        int order = keyOrder(this->compare, searchKey, curPtr->key);
+
+        path[depth] = curPtr;
+
+        if (order < 0)
+        {
+            dirs[depth++] = LEFTTHREAD;
+            curPtr = ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                      NULL : curPtr->leftChildPtr);
+        }
+        else if (order > 0)
+        {
+            dirs[depth++] = RIGHTTHREAD;
+            curPtr = ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD ?
+                      NULL : curPtr->rightChildPtr);
+        }
+        else
+        {
+            break;      // found; path[depth] is not part of the path yet
+        } // end if (order < 0)
+    } // end while (curPtr != NULL)
+
+    if (curPtr == NULL)
+    {
+        throw TreeException(
+                "TreeException: delete failed");    // searchKey not found
+    } // end if (curPtr == NULL)
+
+    delPtr = curPtr;
+
+    if (delPtr->threads == NOTHREAD)
+    {
+        // two children: remove the inorder successor in place of delPtr
+        path[depth] = delPtr;
+        dirs[depth++] = RIGHTTHREAD;
+        curPtr = delPtr->rightChildPtr;
+
+        while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        {
+            path[depth] = curPtr;
+            dirs[depth++] = LEFTTHREAD;
+            curPtr = curPtr->leftChildPtr;
+        } // end while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+        delPtr->key = move(curPtr->key);   // curPtr is freed below
+        delPtr->value = move(curPtr->value);
+        delPtr = curPtr;
+    } // end if (delPtr->threads == NOTHREAD)
+
+    for (int i = 0; i < depth; ++i)
+    {
+        --path[i]->count;   // every subtree on the path loses delPtr
+    } // end for (i < depth)
+
+    if (delPtr->threads == BOTHTHREAD)
+    {
+        // leaf: its parent inherits the thread on the side it occupied
+        if (depth == 0)
+        {
+            this->setRootPtr(NULL);
+        }
+        else if (dirs[depth - 1] == LEFTTHREAD)
+        {
+            path[depth - 1]->leftChildPtr = delPtr->leftChildPtr;
+            path[depth - 1]->threads += LEFTTHREAD;
+        }
+        else
+        {
+            path[depth - 1]->rightChildPtr = delPtr->rightChildPtr;
+            path[depth - 1]->threads += RIGHTTHREAD;
+        } // end if (depth == 0)
+    }
+    else if (delPtr->threads == LEFTTHREAD)
+    {
+        // right child only: its leftmost node inherits the predecessor thread
+        edgePtr = delPtr->rightChildPtr;
+
+        while ((edgePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        {
+            edgePtr = edgePtr->leftChildPtr;
+        } // end while ((edgePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+        edgePtr->leftChildPtr = delPtr->leftChildPtr;
+        setLink(path, dirs, depth, delPtr->rightChildPtr);
+    }
+    else
+    {
+        // left child only: its rightmost node inherits the successor thread
+        edgePtr = delPtr->leftChildPtr;
+
+        while ((edgePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+        {
+            edgePtr = edgePtr->rightChildPtr;
+        } // end while ((edgePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+
+        edgePtr->rightChildPtr = delPtr->rightChildPtr;
+        setLink(path, dirs, depth, delPtr->leftChildPtr);
+    } // end if (delPtr->threads == BOTHTHREAD)
+
+    this->deallocateNode(delPtr);
+
+    // retrace the path; each subtree shrank on the side that was taken
+    while (depth-- > 0)
+    {
+        curPtr = path[depth];
+        curPtr->balance += (dirs[depth] == LEFTTHREAD ? 1 : -1);
+
+        if (curPtr->balance == 1 || curPtr->balance == -1)
+        {
+            break;      // subtree height unchanged
+        }
+        else if (curPtr->balance == 2 || curPtr->balance == -2)
+        {
+            rebalance(curPtr);
+            setLink(path, dirs, depth, curPtr);
+
+            if (curPtr->balance != 0)
+            {
+                break;  // rotation left the subtree height unchanged
+            } // end if (curPtr->balance != 0)
+        } // end if (curPtr->balance == 1 || curPtr->balance == -1)
+    } // end while (depth-- > 0)
+} // end searchTreeDelete(Key&)
+
+/** Rotates a subtree to the left, promoting its right child.
+ * @param nodePtr  Pointer to the root of the subtree to rotate.
+ * @pre nodePtr has a right child, not a right thread.
+ * @post nodePtr points to the former right child, whose left subtree is the
+ *       former root. Threads, balances and subtree counts of both nodes are
+ *       updated.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::rotateLeft(TreeNode *& nodePtr)
+{
+    TreeNode *pivot = nodePtr->rightChildPtr;
+
+    if ((pivot->threads & LEFTTHREAD) == LEFTTHREAD)
+    {
+        // pivot has no left subtree to hand over; nodePtr keeps a thread to
+        // pivot, its inorder successor
+        // Assert: pivot->leftChildPtr == nodePtr
+        nodePtr->threads += RIGHTTHREAD;
+        pivot->threads -= LEFTTHREAD;
+    }
+    else
+    {
+        nodePtr->rightChildPtr = pivot->leftChildPtr;
+    } // end if ((pivot->threads & LEFTTHREAD) == LEFTTHREAD)
+
+    pivot->leftChildPtr = nodePtr;
+    this->recount(nodePtr);         // nodePtr is now below pivot
+    this->recount(pivot);
+
+    // balances follow from the heights of the three subtrees that moved
+    nodePtr->balance -= 1 + (pivot->balance > 0 ? pivot->balance : 0);
+    pivot->balance -= 1 - (nodePtr->balance < 0 ? nodePtr->balance : 0);
+    nodePtr = pivot;
+} // end rotateLeft(TreeNode*&)
+
+/** Rotates a subtree to the right, promoting its left child.
+ * @param nodePtr  Pointer to the root of the subtree to rotate.
+ * @pre nodePtr has a left child, not a left thread.
+ * @post nodePtr points to the former left child, whose right subtree is the
+ *       former root. Threads, balances and subtree counts of both nodes are
+ *       updated.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::rotateRight(TreeNode *& nodePtr)
+{
+    TreeNode *pivot = nodePtr->leftChildPtr;
+
+    if ((pivot->threads & RIGHTTHREAD) == RIGHTTHREAD)
+    {
+        // pivot has no right subtree to hand over; nodePtr keeps a thread to
+        // pivot, its inorder predecessor
+        // Assert: pivot->rightChildPtr == nodePtr
+        nodePtr->threads += LEFTTHREAD;
+        pivot->threads -= RIGHTTHREAD;
+    }
+    else
+    {
+        nodePtr->leftChildPtr = pivot->rightChildPtr;
+    } // end if ((pivot->threads & RIGHTTHREAD) == RIGHTTHREAD)
+
+    pivot->rightChildPtr = nodePtr;
+    this->recount(nodePtr);         // nodePtr is now below pivot
+    this->recount(pivot);
+
+    // balances follow from the heights of the three subtrees that moved
+    nodePtr->balance += 1 - (pivot->balance < 0 ? pivot->balance : 0);
+    pivot->balance += 1 + (nodePtr->balance > 0 ? nodePtr->balance : 0);
+    nodePtr = pivot;
+} // end rotateRight(TreeNode*&)
+
+/** Restores balance to a subtree whose root has a balance of 2 or -2.
+ * @param nodePtr  Pointer to the root of the unbalanced subtree.
+ * @pre The subtrees of nodePtr are balanced and differ in height by two.
+ * @post nodePtr points to the new root of a balanced subtree, made by a single
+ *       or double rotation.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::rebalance(TreeNode *& nodePtr)
+{
+    if (nodePtr->balance < 0)
+    {
+        // left heavy; a right-leaning left child needs a double rotation
+        if (nodePtr->leftChildPtr->balance > 0)
+        {
+            rotateLeft(nodePtr->leftChildPtr);
+        } // end if (nodePtr->leftChildPtr->balance > 0)
+
+        rotateRight(nodePtr);
+    }
+    else
+    {
+        // right heavy; a left-leaning right child needs a double rotation
+        if (nodePtr->rightChildPtr->balance < 0)
+        {
+            rotateRight(nodePtr->rightChildPtr);
+        } // end if (nodePtr->rightChildPtr->balance < 0)
+
+        rotateLeft(nodePtr);
+    } // end if (nodePtr->balance < 0)
+} // end rebalance(TreeNode*&)
+
+/** Points the link that held one node of a search path at a new node.
+ * @param path  Nodes visited from the root, path[0] being the root.
+ * @param dirs  LEFTTHREAD or RIGHTTHREAD for the step taken from each node in
+ *        path.
+ * @param depth  Index in path of the node whose link is replaced.
+ * @param newPtr  The node that takes the place of path[depth].
+ * @pre path and dirs describe a valid path of at least depth nodes.
+ * @post The root, or the child pointer of path[depth - 1], is newPtr.
+ */
+template <class Key, class Value, class Compare>
+void AVLThreadedBST<Key, Value, Compare>::setLink(TreeNode **path,
+                                                  const int *dirs,
+                                                  int depth,
+                                                  TreeNode *newPtr)
+{
+    if (depth == 0)
+    {
+        this->setRootPtr(newPtr);
+    }
+    else if (dirs[depth - 1] == LEFTTHREAD)
+    {
+        path[depth - 1]->leftChildPtr = newPtr;
+    }
+    else
+    {
+        path[depth - 1]->rightChildPtr = newPtr;
+    } // end if (depth == 0)
+} // end setLink(TreeNode**, const int*, int, TreeNode*)
+
+
+#endif	/* _AVLTHREADEDBST_CPP */
@@ -0,0 +1,133 @@
+/*
+ * @file    AVLThreadedBST.h
+ * @brief   A threaded binary search tree that keeps itself height-balanced by
+ *          the AVL rules. Each node records the height of its right subtree
+ *          minus the height of its left subtree. After an insertion or a
+ *          deletion, the balance of each node on the path back to the root is
+ *          adjusted, and any node whose balance reaches 2 or -2 is restored by
+ *          a single or double rotation. Rotations rewire thread pointers as
+ *          they move subtrees, so the inorder threads, and therefore the
+ *          Inorder iterator, remain valid. Search cost stays O(log n) no
+ *          matter the order in which items arrive.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _AVLTHREADEDBST_H
+#define	_AVLTHREADEDBST_H
+
+#include "ThreadedBST.h"
+
+// An AVL tree of n nodes is never taller than 1.44 * log2(n + 2), so this
+// bounds the search path for any tree that fits in memory.
+const int MAXTREEHEIGHT = 96;
+
+
+template <class Key, class Value, class Compare = KeyLess>
+class AVLThreadedBST : public ThreadedBST<Key, Value, Compare>
+{
+public:
+
+    typedef typename ThreadedBST<Key, Value, Compare>::TreeNode TreeNode;
+
+ // constructors and destructor:
+    AVLThreadedBST();
+
+    AVLThreadedBST(const AVLThreadedBST& orig)
+            throw(TreeException);
+
+    AVLThreadedBST(AVLThreadedBST&& orig)
+            throw();
+
+    virtual ~AVLThreadedBST();
+
+    /** Copies the contents of rhs into this tree.
+     * @param rhs  The right-hand tree to be copied.
+     * @pre There is sufficient memory to allocate a copy of rhs.
+     * @post This tree is a structural copy of rhs; rhs remains unchanged.
+     * @return This tree.
+     * @throw TreeException  If memory allocation fails.
+     */
+    AVLThreadedBST& operator=(const AVLThreadedBST& rhs)
+                    throw(TreeException);
+
+    /** Moves the contents of rhs into this tree.
+     * @param rhs  The right-hand tree whose nodes are taken.
+     * @pre None.
+     * @post This tree holds the items rhs held, without copying any of them;
+     *       rhs is empty.
+     * @return This tree.
+     */
+    AVLThreadedBST& operator=(AVLThreadedBST&& rhs)
+                    throw();
+
+    /** Deletes an item with a given search key from a balanced threaded
+     *  binary search tree.
+     * @param searchKey  Key of the item to locate and remove from this tree.
+     * @pre searchKey is the search key of the item to be deleted.
+     * @post If the item whose search key equals searchKey existed in the tree,
+     *       the item is deleted and the tree is rebalanced. Otherwise, the
+     *       tree is unchanged.
+     * @throw TreeException  If searchKey is not found in the tree.
+     */
+    virtual void searchTreeDelete(const Key& searchKey)
+                 throw(TreeException);
+
+protected:
+
+    /** Links a new node into a balanced threaded binary search tree. Both
+     *  forms of searchTreeInsert() reach this after allocating the node.
+     * @param treePtr  Pointer to the root of this tree.
+     * @param newPtr  The node to be inserted, made by allocateNode().
+     * @pre treePtr is the root of this tree; newPtr is not linked into any
+     *      tree.
+     * @post The key of newPtr is in its proper order in the tree, its threads
+     *       point to its inorder predecessor and successor, and no node in the
+     *       tree has subtrees whose heights differ by more than one.
+     */
+    virtual void insertItem(TreeNode *& treePtr, TreeNode *newPtr);
+
+    /** Rotates a subtree to the left, promoting its right child.
+     * @param nodePtr  Pointer to the root of the subtree to rotate.
+     * @pre nodePtr has a right child, not a right thread.
+     * @post nodePtr points to the former right child, whose left subtree is
+     *       the former root. Threads, balances and subtree counts of both
+     *       nodes are updated.
+     */
+    void rotateLeft(TreeNode *& nodePtr);
+
+    /** Rotates a subtree to the right, promoting its left child.
+     * @param nodePtr  Pointer to the root of the subtree to rotate.
+     * @pre nodePtr has a left child, not a left thread.
+     * @post nodePtr points to the former left child, whose right subtree is
+     *       the former root. Threads, balances and subtree counts of both
+     *       nodes are updated.
+     */
+    void rotateRight(TreeNode *& nodePtr);
+
+    /** Restores balance to a subtree whose root has a balance of 2 or -2.
+     * @param nodePtr  Pointer to the root of the unbalanced subtree.
+     * @pre The subtrees of nodePtr are balanced and differ in height by two.
+     * @post nodePtr points to the new root of a balanced subtree, made by a
+     *       single or double rotation.
+     */
+    void rebalance(TreeNode *& nodePtr);
+
+    /** Points the link that held one node of a search path at a new node.
+     * @param path  Nodes visited from the root, path[0] being the root.
+     * @param dirs  LEFTTHREAD or RIGHTTHREAD for the step taken from each
+     *        node in path.
+     * @param depth  Index in path of the node whose link is replaced.
+     * @param newPtr  The node that takes the place of path[depth].
+     * @pre path and dirs describe a valid path of at least depth nodes.
+     * @post The root, or the child pointer of path[depth - 1], is newPtr.
+     */
+    void setLink(TreeNode **path, const int *dirs, int depth,
+                 TreeNode *newPtr);
+
+}; // end AVLThreadedBST
+
+
+#include "AVLThreadedBST.cpp"
+
+#endif	/* _AVLTHREADEDBST_H */
@@ -57,44 +57,39 @@ Transaction* Borrow::copy(void) const
     // copy each data member
     tempTrans->setMediaCode(getMediaCode());
     tempTrans->setCustID(getCustID());
-    tempTrans->setItem(getItem());
+    tempTrans->adoptItem(getItem());
 
     return tempTrans;
 } // end copy()
 
 bool Borrow::process(MOVIEStore& target) const
 {
-    Merch *tempMerch = getItem();
+    const Merch *tempMerch = peekItem();  // borrowed, so nothing to delete
     Customer tempCust(getCustID());
 
-    if (!target.retrieveItem(tempMerch))    // tempMerch is updated during check
-    {
-        return false;
-    } // end if (!target.findItem(tempMerch))
-    
     target.retrieveCustomer(tempCust);      // get full Customer record
 
-    // ensure stock can be decreased
-    if (!tempMerch->setOnHandQty(tempMerch->getOnHandQty() - 1) ||
-            tempCust.isBorrowing(tempMerch))
+    // the Customer is checked first, so no copy is taken only to go back
+    if (tempMerch == NULL || tempCust.isBorrowing(tempMerch))
     {
         return false;   // item cannot be borrowed
-    } // end if (tempMerch->setOnHandQty(...) ...)
+    } // end if (tempMerch == NULL || ...)
+
+    // one atomic step on the stocked item; nothing is copied or replaced
+    if (!target.borrowItem(tempMerch))
+    {
+        return false;   // item is not stocked, or none can be spared
+    } // end if (!target.borrowItem(tempMerch))
 
-    // item is in stock and Customer is not borrowing it
-    target.updateItem(tempMerch);       // take one item out of Inventory
     tempCust.newTransaction(this);      // add this Transaction to History
     target.updateCustomer(tempCust);    // update target's Customer List
 
-    delete tempMerch;
-    tempMerch = NULL;
-
     return true;
 } // end process(MOVIEStore&)
 
 void Borrow::display(ostream& output) const
 {
-    Merch *tempMerch = getItem();
+    const Merch *tempMerch = peekItem();
 
     if (tempMerch != NULL)          // there is an item
     {
@@ -0,0 +1,185 @@
+/*
+ * @file    Catalog.cpp
+ * @brief   A column-oriented copy of the movies in an Inventory, for scans of
+ *          the whole collection. Each movie is given a movie ID, its position
+ *          in the catalog, and each of its attributes is kept in an array of
+ *          its own at that position: titles, directors, years, genres, stock
+ *          quantities and on-hand quantities. A filter or a total then reads
+ *          one or two arrays from front to back instead of visiting every
+ *          Merch object through the partitions of the Inventory. A tree maps
+ *          the search key of each movie to its ID. The catalog is a
+ *          snapshot; it does not follow later changes to the Inventory it was
+ *          built from, except on-hand quantities that are set through it.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#include <cstdlib>
+#include <new>
+#include "Catalog.h"
+
+
+Catalog::Catalog()
+{
+} // end Default Constructor
+
+Catalog::~Catalog()
+{
+} // end Destructor
+
+void Catalog::clear(void)
+{
+    titles.clear();
+    directors.clear();
+    years.clear();
+    genres.clear();
+    stockQtys.clear();
+    onHandQtys.clear();
+    ids = AVLThreadedBST<ItemKey, MovieID>();
+} // end clear()
+
+MovieID Catalog::addMovie(const Merch *item)
+{
+    MovieID   movie = getLength();
+    ValueType title, director, year, itemCode;
+    int       yearNumber;
+
+    item->getField(TITLEFIELD, title);
+    item->getField(DIRECTORFIELD, director);
+    item->getField(YEARFIELD, year);
+    item->getField(ITEMCODEFIELD, itemCode);
+    yearNumber = atoi(year.c_str());
+
+    try
+    {
+        ids.searchTreeInsert(item->getItemKey(), movie);
+    }
+    catch (TreeException e)
+    {
+        return NOMOVIE;     // not cataloged; the columns are unchanged
+    } // end try
+
+    try
+    {
+        titles.push_back(StringArena::shared().intern(title));
+        directors.push_back(StringArena::shared().intern(director));
+        years.push_back(yearNumber > 0 && yearNumber <= UINT16_MAX ?
+                        yearNumber : 0);
+        genres.push_back(itemCode.empty() ? '\0' : itemCode[0]);
+        stockQtys.push_back(item->getStockQty());
+        onHandQtys.push_back(item->getOnHandQty());
+    }
+    catch (bad_alloc e)
+    {
+        // trim every column back to the movies already cataloged
+        titles.resize(movie);
+        directors.resize(movie);
+        years.resize(movie);
+        genres.resize(movie);
+        stockQtys.resize(movie);
+        onHandQtys.resize(movie);
+        ids.searchTreeDelete(item->getItemKey());
+        return NOMOVIE;
+    } // end try
+
+    return movie;
+} // end addMovie(Merch*)
+
+MovieID Catalog::findID(const ItemKey& searchKey) const
+{
+    MovieID movie;
+
+    return (ids.tryRetrieve(searchKey, movie) ? movie : NOMOVIE);
+} // end findID(ItemKey&)
+
+int Catalog::getLength(void) const
+{
+    return static_cast<int>(titles.size());
+} // end getLength()
+
+TextRef Catalog::getTitle(MovieID movie) const
+{
+    return titles[movie];
+} // end getTitle(MovieID)
+
+TextRef Catalog::getDirector(MovieID movie) const
+{
+    return directors[movie];
+} // end getDirector(MovieID)
+
+int Catalog::getYear(MovieID movie) const
+{
+    return years[movie];
+} // end getYear(MovieID)
+
+char Catalog::getGenre(MovieID movie) const
+{
+    return genres[movie];
+} // end getGenre(MovieID)
+
+int Catalog::getStockQty(MovieID movie) const
+{
+    return stockQtys[movie];
+} // end getStockQty(MovieID)
+
+int Catalog::getOnHandQty(MovieID movie) const
+{
+    return onHandQtys[movie];
+} // end getOnHandQty(MovieID)
+
+bool Catalog::setOnHandQty(MovieID movie, int newQty)
+{
+    bool success = newQty >= 0 && newQty <= stockQtys[movie];
+
+    if (success)    // quantity fits within the stock of this movie
+    {
+        onHandQtys[movie] = newQty;
+    } // end if (success)
+
+    return success;
+} // end setOnHandQty(MovieID, int)
+
+int Catalog::countOutOfStock(char genre) const
+{
+    const char *itemGenre = genres.data();
+    const int  *onHand = onHandQtys.data();
+    int         length = getLength();
+    int         count = 0;
+
+    // no branches in the loop, so the compiler is free to vectorize it
+    for (int i = 0; i < length; ++i)
+    {
+        count += (itemGenre[i] == genre) & (onHand[i] == 0);
+    } // end for (i < length)
+
+    return count;
+} // end countOutOfStock(char)
+
+int Catalog::getOnHandTotal(void) const
+{
+    const int *onHand = onHandQtys.data();
+    int        length = getLength();
+    int        total = 0;
+
+    for (int i = 0; i < length; ++i)
+    {
+        total += onHand[i];
+    } // end for (i < length)
+
+    return total;
+} // end getOnHandTotal()
+
+void Catalog::findByYear(int firstYear, int lastYear,
+                         vector<MovieID>& movies) const
+{
+    const uint16_t *year = years.data();
+    int             length = getLength();
+
+    for (int i = 0; i < length; ++i)
+    {
+        if (year[i] >= firstYear && year[i] <= lastYear)
+        {
+            movies.push_back(i);
+        } // end if (year[i] >= firstYear && year[i] <= lastYear)
+    } // end for (i < length)
+} // end findByYear(int, int, vector<MovieID>&)
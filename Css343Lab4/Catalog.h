@@ -0,0 +1,185 @@
+/*
+ * @file    Catalog.h
+ * @brief   A column-oriented copy of the movies in an Inventory, for scans of
+ *          the whole collection. Each movie is given a movie ID, its position
+ *          in the catalog, and each of its attributes is kept in an array of
+ *          its own at that position: titles, directors, years, genres, stock
+ *          quantities and on-hand quantities. A filter or a total then reads
+ *          one or two arrays from front to back instead of visiting every
+ *          Merch object through the partitions of the Inventory. A tree maps
+ *          the search key of each movie to its ID. The catalog is a
+ *          snapshot; it does not follow later changes to the Inventory it was
+ *          built from, except on-hand quantities that are set through it.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _CATALOG_H
+#define	_CATALOG_H
+
+#include <cstdint>
+#include <vector>
+#include "AVLThreadedBST.h"
+#include "KeyedItem.h"
+#include "Merch.h"
+#include "StringArena.h"
+
+typedef int MovieID;
+
+const MovieID NOMOVIE = -1;         // ID of a movie that is not cataloged
+
+
+class Catalog
+{
+public:
+
+/**---------------------- Default Constructor ---------------------------------
+ * Creates an empty Catalog.
+ * @pre None.
+ * @post An empty Catalog exists.
+ */
+    Catalog();
+
+    virtual ~Catalog();
+
+/**---------------------- clear() ---------------------------------------------
+ * Removes every movie from this Catalog.
+ * @pre None.
+ * @post This Catalog is empty. IDs it gave out are no longer valid.
+ */
+    void clear(void);
+
+/**---------------------- addMovie() ------------------------------------------
+ * Copies the attributes of a movie into the next position of this Catalog.
+ * @param item  The movie to catalog.
+ * @pre item is not NULL and its search key is not in this Catalog.
+ * @post The attributes of item are at the returned position. A year that is
+ *       not a number is cataloged as 0, and the genre is the first letter of
+ *       the item code.
+ * @return The ID of the movie, or NOMOVIE if it could not be added.
+ */
+    MovieID addMovie(const Merch *item);
+
+/**---------------------- findID() --------------------------------------------
+ * Retrieves the ID of a movie from its typed search key.
+ * @param searchKey  The typed search key of the movie.
+ * @pre None.
+ * @post None.
+ * @return The ID of the movie, or NOMOVIE if it is not in this Catalog.
+ */
+    MovieID findID(const ItemKey& searchKey) const;
+
+/**---------------------- getLength() -----------------------------------------
+ * Counts the movies in this Catalog. IDs run from 0 to one less than this.
+ * @pre None.
+ * @post None.
+ * @return The number of movies in this Catalog.
+ */
+    int getLength(void) const;
+
+/**---------------------- getTitle() ------------------------------------------
+ * Retrieves the title of a cataloged movie.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return A view of the title of the movie, in the shared arena.
+ */
+    TextRef getTitle(MovieID movie) const;
+
+/**---------------------- getDirector() ---------------------------------------
+ * Retrieves the director of a cataloged movie.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return A view of the director of the movie, in the shared arena.
+ */
+    TextRef getDirector(MovieID movie) const;
+
+/**---------------------- getYear() -------------------------------------------
+ * Retrieves the year of a cataloged movie.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return The year of the movie, or 0 if it had none.
+ */
+    int getYear(MovieID movie) const;
+
+/**---------------------- getGenre() ------------------------------------------
+ * Retrieves the genre of a cataloged movie.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return The first letter of the item code of the movie.
+ */
+    char getGenre(MovieID movie) const;
+
+/**---------------------- getStockQty() ---------------------------------------
+ * Retrieves the quantity of a cataloged movie that is normally stocked.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return The stock quantity of the movie.
+ */
+    int getStockQty(MovieID movie) const;
+
+/**---------------------- getOnHandQty() --------------------------------------
+ * Retrieves the quantity of a cataloged movie that is available.
+ * @param movie  The ID of the movie.
+ * @pre 0 <= movie < getLength().
+ * @post None.
+ * @return The on-hand quantity of the movie.
+ */
+    int getOnHandQty(MovieID movie) const;
+
+/**---------------------- setOnHandQty() --------------------------------------
+ * Sets the quantity of a cataloged movie that is available.
+ * @param movie  The ID of the movie.
+ * @param newQty  The new on-hand quantity; from 0 to the stock quantity.
+ * @pre 0 <= movie < getLength().
+ * @post The on-hand quantity of the movie is newQty, if it was in range.
+ * @return true if newQty was in range; false, otherwise.
+ */
+    bool setOnHandQty(MovieID movie, int newQty);
+
+/**---------------------- countOutOfStock() -----------------------------------
+ * Counts the movies of a genre that have no copies on hand.
+ * @param genre  The first letter of the item code of the genre.
+ * @pre None.
+ * @post None.
+ * @return The number of movies of genre whose on-hand quantity is 0.
+ */
+    int countOutOfStock(char genre) const;
+
+/**---------------------- getOnHandTotal() ------------------------------------
+ * Counts the copies of every movie on hand.
+ * @pre None.
+ * @post None.
+ * @return The sum of the on-hand quantities of every movie.
+ */
+    int getOnHandTotal(void) const;
+
+/**---------------------- findByYear() ----------------------------------------
+ * Lists the movies released in a range of years.
+ * @param firstYear  The earliest year to include.
+ * @param lastYear  The latest year to include.
+ * @param movies  A container to which the IDs of the movies are appended.
+ * @pre None.
+ * @post movies ends with the IDs of every movie whose year is from firstYear
+ *       to lastYear, in increasing order of ID.
+ */
+    void findByYear(int firstYear, int lastYear,
+                    vector<MovieID>& movies) const;
+
+private:
+
+    vector<TextRef>   titles;       // title of each movie
+    vector<TextRef>   directors;    // director of each movie
+    vector<uint16_t>  years;        // year of each movie; 0 if unknown
+    vector<char>      genres;       // first letter of each item code
+    vector<int>       stockQtys;    // quantity of each movie normally stocked
+    vector<int>       onHandQtys;   // quantity of each movie available
+    AVLThreadedBST<ItemKey, MovieID> ids;   // ID of each search key
+
+}; // end class Catalog
+
+#endif	/* _CATALOG_H */
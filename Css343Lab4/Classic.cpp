@@ -10,47 +10,44 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include "Classic.h"
 
 
-Classic::Classic()
+Classic::Classic() : month(0)
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Classic");
-    setField(tempKey);
 } // end Default Constructor
 
-Classic::Classic(const string& searchKey) : DVDMedia(searchKey)
+Classic::Classic(const string& searchKey) : DVDMedia(searchKey), month(0)
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Classic");
-    setField(tempKey);
 } // end Constructor
 
 Classic::~Classic()
 {
 } // end Destructor
 
+void Classic::assign(const Merch& source)
+{
+    const Classic *movie = dynamic_cast<const Classic*>(&source);
+
+    DVDMedia::assign(source);
+
+    if (movie != NULL)      // copy the typed members, too
+    {
+        majorActor = movie->majorActor;
+        month = movie->month;
+    } // end if (movie != NULL)
+} // end assign(Merch&)
+
 bool Classic::updateSearchKey(void)
 {
-    KeyedItem tempKey;
     string year, month, majorActor, searchKey = "";
 
     try
     {
-        tempKey.setKey("Year");
-        getField(tempKey);
-        year = tempKey.getValue();
-
-        tempKey.setKey("Month");
-        getField(tempKey);
-        month = tempKey.getValue();
-
-        tempKey.setKey("Major Actor");
-        getField(tempKey);
-        majorActor = tempKey.getValue();
+        getField(YEARFIELD, year);
+        getField(MONTHFIELD, month);
+        getField(MAJORACTORFIELD, majorActor);
 
         searchKey += year;
         searchKey += " ";
@@ -65,6 +62,11 @@ bool Classic::updateSearchKey(void)
         searchKey += majorActor;
 
         setSearchKey(searchKey);
+
+        // sorted by year and month packed into one number, then by actor
+        setItemKey(ItemKey(TextRef(),
+                           (static_cast<uint32_t>(getYear()) << 4) |
+                           this->month, this->majorActor));
     }
     catch (TreeException e)
     {
@@ -77,61 +79,17 @@ bool Classic::updateSearchKey(void)
 
 Merch* Classic::copy(void) const
 {
-    Merch *tempMerch = new Classic();
-    KeyedItem tempKey("Director");
-
-    tempMerch->setStockQty(getStockQty());
-    tempMerch->setOnHandQty(getOnHandQty());
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Title");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Month");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Major Actor");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Classic");
-    tempMerch->setField(tempKey);
-
-    tempMerch->updateSearchKey();
-
-    return tempMerch;
+    // the typed fields are copied as members, the rest node for node
+    return new Classic(*this);
 } // end copy()
 
 void Classic::display(void) const
 {
-    KeyedItem tempKey("Title");
-
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 20);
-
-    tempKey.setKey("Director");
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 15);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    cout << right << setw(6) << tempKey.getValue();
-
-    tempKey.setKey("Month");
-    getField(tempKey);
-    cout << right << setw(3) << tempKey.getValue();
-
-    tempKey.setKey("Major Actor");
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 15);
+    cout << left << getTitle().substr(0, 20);
+    cout << left << getDirector().substr(0, 15);
+    cout << right << setw(6) << numberText(getYear());
+    cout << right << setw(3) << numberText(month);
+    cout << left << majorActor.substr(0, 15);
 } // end display()
 
 void Classic::displayLine(void) const
@@ -146,35 +104,14 @@ void Classic::displayLine(void) const
 DVDMedia* Classic::create(ifstream& infile) const
 {
     string    month, year, actorFirst, actorLast;
-    KeyedItem tempKey;
     Classic  *newClassic = new Classic;
 
     infile >> actorFirst >> actorLast;  // input star's name
     infile >> month >> year;            // input month and year;
 
-    if (tempKey.setKey("Major Actor"))
-    {
-        tempKey.setValue(actorFirst + " " + actorLast);
-    } // end if (key.setKey("Major Actor"))
-
-    newClassic->setField(tempKey);
-
-    if (tempKey.setKey("Month"))
-    {
-        tempKey.setValue(month);
-    } // end if (tempKey.setKey("Month"))
-
-    newClassic->setField(tempKey);
-
-    tempKey.setKey("Year");
-    tempKey.setValue(year);
-    
-    newClassic->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Classic");
-
-    newClassic->setField(tempKey);
+    newClassic->setField(MAJORACTORFIELD, actorFirst + " " + actorLast);
+    newClassic->setField(MONTHFIELD, move(month));
+    newClassic->setField(YEARFIELD, move(year));
 
     return newClassic;
 } // end create()
@@ -211,3 +148,41 @@ DVDMedia* Classic::create(ifstream& infile, char mediaCode) const
 
     return NULL;
 } // end create()
+
+bool Classic::readField(FieldID field, ValueType& fieldValue) const
+{
+    switch (field)
+    {
+        case MONTHFIELD:
+            fieldValue = numberText(month);
+            return month != 0;
+        case MAJORACTORFIELD:
+            fieldValue = majorActor.str();
+            return !majorActor.empty();
+        default:
+            return DVDMedia::readField(field, fieldValue);
+    } // end switch (field)
+} // end readField(FieldID, ValueType&)
+
+bool Classic::writeField(FieldID field, ValueType& newValue)
+{
+    int number;
+
+    switch (field)
+    {
+        case MONTHFIELD:
+            // a month that does not fit is kept as text in the field tree
+            month = (parseNumber(newValue, 12, number) ? number : 0);
+            return month != 0;
+        case MAJORACTORFIELD:
+            majorActor = StringArena::shared().intern(newValue);
+            return true;
+        default:
+            return DVDMedia::writeField(field, newValue);
+    } // end switch (field)
+} // end writeField(FieldID, ValueType&)
+
+const char* Classic::itemCode(void) const
+{
+    return "Classic";
+} // end itemCode()
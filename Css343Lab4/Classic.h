@@ -23,6 +23,14 @@ public:
 
     ~Classic();
 
+/**---------------------- assign() --------------------------------------------
+ * Copies another classic into this one, including its major actor and month.
+ * @param source  The Merchandise to be copied; of the same class as this one.
+ * @pre None.
+ * @post This classic has the search key, quantities and fields of source.
+ */
+    virtual void assign(const Merch& source);
+
     virtual bool updateSearchKey(void);
 
     virtual Merch* copy(void) const;
@@ -35,8 +43,40 @@ public:
 
     virtual DVDMedia* create(ifstream& infile, char mediaCode) const;
 
+protected:
+
+/**---------------------- readField() -----------------------------------------
+ * Retrieves the month or major actor of this classic from its typed members,
+ * or any field kept by DVDMedia.
+ * @param field  The atom of the field to look up.
+ * @param fieldValue  A container for the value of the field, if found.
+ * @pre None.
+ * @post fieldValue contains the value of the field, if it is kept in a typed
+ *       member and has been set.
+ * @return true if fieldValue was updated; false, otherwise.
+ */
+    virtual bool readField(FieldID field, ValueType& fieldValue) const;
+
+/**---------------------- writeField() ----------------------------------------
+ * Stores the month or major actor of this classic in its typed members, or
+ * any field kept by DVDMedia.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to store; moved from if it is taken.
+ * @pre None.
+ * @post If the field is kept in a typed member, that member holds newValue.
+ *       A month that is not a number from 1 to 12 is left to the field tree.
+ * @throw bad_alloc  If text cannot be stored in the shared arena.
+ * @return true if the value was taken; false, otherwise.
+ */
+    virtual bool writeField(FieldID field, ValueType& newValue);
+
+    virtual const char* itemCode(void) const;
+
 private:
 
+    TextRef   majorActor;       // famous actor, in the shared arena
+    uint8_t   month;            // month of release; 0 if not set
+
 }; // end class Classic
 
 #endif	/* _CLASSIC_H */
@@ -10,23 +10,16 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include "Comedy.h"
 
 
 Comedy::Comedy()
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Funny");
-    setField(tempKey);
 } // end Default Constructor
 
 Comedy::Comedy(const string& searchKey) : DVDMedia(searchKey)
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Funny");
-    setField(tempKey);
 } // end Constructor
 
 Comedy::~Comedy()
@@ -35,24 +28,19 @@ Comedy::~Comedy()
 
 bool Comedy::updateSearchKey(void)
 {
-    KeyedItem tempKey;
     string title, year, searchKey = "";
 
     try
     {
-        tempKey.setKey("Title");
-        getField(tempKey);
-        title = tempKey.getValue();
-        
-        tempKey.setKey("Year");
-        getField(tempKey);
-        year = tempKey.getValue();
+        getField(TITLEFIELD, title);
+        getField(YEARFIELD, year);
 
         searchKey += title;
         searchKey += " ";
         searchKey += year;
 
         setSearchKey(searchKey);
+        setItemKey(ItemKey(getTitle(), getYear(), TextRef()));
     }
     catch (TreeException e)
     {
@@ -65,45 +53,15 @@ bool Comedy::updateSearchKey(void)
 
 Merch* Comedy::copy() const
 {
-    Merch *tempMerch = new Comedy();
-    KeyedItem tempKey("Director");
-
-    tempMerch->setStockQty(getStockQty());
-    tempMerch->setOnHandQty(getOnHandQty());
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Title");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Funny");
-    tempMerch->setField(tempKey);
-
-    tempMerch->updateSearchKey();
-
-    return tempMerch;
+    // the typed fields are copied as members, the rest node for node
+    return new Comedy(*this);
 } // end copy()
 
 void Comedy::display(void) const
 {
-    KeyedItem tempKey("Title");
-
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 20);
-
-    tempKey.setKey("Director");
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 15);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    cout << right << setw(6) << tempKey.getValue();
+    cout << left << getTitle().substr(0, 20);
+    cout << left << getDirector().substr(0, 15);
+    cout << right << setw(6) << numberText(getYear());
 } // end display()
 
 void Comedy::displayLine(void) const
@@ -118,20 +76,11 @@ void Comedy::displayLine(void) const
 DVDMedia* Comedy::create(ifstream& infile) const
 {
     string    year;
-    KeyedItem tempKey;
     Comedy   *newComedy = new Comedy;
 
     infile >> year;
 
-    tempKey.setKey("Year");
-    tempKey.setValue(year);
-
-    newComedy->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Funny");
-
-    newComedy->setField(tempKey);
+    newComedy->setField(YEARFIELD, move(year));
 
     return newComedy;
 } // end create()
@@ -152,3 +101,8 @@ DVDMedia* Comedy::create(ifstream& infile, char mediaCode) const
 
     return NULL;
 } // end create()
+
+const char* Comedy::itemCode(void) const
+{
+    return "Funny";
+} // end itemCode()
@@ -35,6 +35,10 @@ public:
 
     virtual DVDMedia* create(ifstream& infile, char mediaCode) const;
 
+protected:
+
+    virtual const char* itemCode(void) const;
+
 private:
 
 }; // end class Comedy
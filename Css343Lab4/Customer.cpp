@@ -11,6 +11,8 @@
 #include "Customer.h"
 
 
+atomic<int> Customer::fieldMisses(0);
+
 Customer::Customer() : customerID(0)
 {
 } // end Default Constructor
@@ -45,51 +47,82 @@ void Customer::setID(int newID)
 
 bool Customer::getField(KeyedItem& target) const
 {
-    bool success;
+    FieldID   field = FieldAtom::find(target.getKey());
+    ValueType fieldValue;
+    bool      success = false;
 
-    try
+    if (field == NOFIELD)   // no customer has a field by this name
     {
-        info.searchTreeRetrive(target.getKey(), target);
-        success = true;     // field found and target parameter updated
+        fieldMisses.fetch_add(1, memory_order_relaxed);
     }
-    catch (TreeException e)
+    else if (getField(field, fieldValue))
     {
-        cout << "ERROR: " << target.getKey() << " not found in customer with"
-             << " ID number " << customerID << endl;
-        success = false;    // field not found
-    } // end try
+        target.setValue(fieldValue);
+        success = true;     // field found and target parameter updated
+    } // end if (field == NOFIELD)
 
     return success;
 } // end getField(KeyedItem&)
 
+bool Customer::getField(FieldID field, ValueType& fieldValue) const
+{
+    bool success = info.tryRetrieve(field, fieldValue);
+
+    if (!success)   // field not found
+    {
+        fieldMisses.fetch_add(1, memory_order_relaxed);
+    } // end if (!success)
+
+    return success;
+} // end getField(FieldID, ValueType&)
+
+int Customer::getFieldMisses(void)
+{
+    return fieldMisses.load(memory_order_relaxed);
+} // end getFieldMisses()
+
 void Customer::setField(const KeyedItem& newValue)
 {
     try
     {
-        info.searchTreeDelete(newValue.getKey());
+        setField(FieldAtom::intern(newValue.getKey()), newValue.getValue());
     }
     catch (TreeException e)
     {
+        cout << "ERROR: " << newValue.getKey() << " coult not be inserted into"
+             << " customer with ID number " << customerID << endl;
     } // end try
+} // end setField(KeyedItem&)
+
+void Customer::setField(FieldID field, const ValueType& newValue)
+{
+    ValueType *fieldValue = info.findMutable(field);
+
+    if (fieldValue != NULL)     // field exists; change its value in place
+    {
+        *fieldValue = newValue;
+        return;
+    } // end if (fieldValue != NULL)
 
     try
     {
-        info.searchTreeInsert(newValue);
+        info.searchTreeInsert(field, newValue);
     }
     catch (TreeException e)
     {
-        cout << "ERROR: " << newValue.getKey() << " coult not be inserted into"
-             << " customer with ID number " << customerID << endl;
+        cout << "ERROR: " << FieldAtom::nameOf(field) << " coult not be"
+             << " inserted into customer with ID number " << customerID
+             << endl;
     } // end try
-} // end setField(KeyedItem&)
+} // end setField(FieldID, ValueType&)
 
 void Customer::displayInfo(ostream& output) const
 {
-    ThreadedBST::Inorder index(info.begin());
+    ThreadedBST<FieldID, ValueType>::Inorder index(info.begin());
 
     while(index != info.end())
     {
-        output << (*index).getKey() << ' ' << (*index).getValue() << endl;
+        output << FieldAtom::nameOf(index.getKey()) << ' ' << *index << endl;
         ++index;
     } // end while()
 } // end getInfo()
@@ -111,20 +144,10 @@ Transaction* Customer::getMostRecent(void) const
 
 void Customer::displayHistory(ostream& output) const
 {
-    KeyedItem tempKey;
-    string nameFirst, nameLast;
+    ValueType nameFirst, nameLast;
 
-    try
-    {
-        info.searchTreeRetrive("First Name", tempKey);
-        nameFirst = tempKey.getValue();
-        info.searchTreeRetrive("Last Name", tempKey);
-        nameLast = tempKey.getValue();
-    }
-    catch(TreeException e)
-    {
-        cout << "ERROR: Could not find customer name." << endl;
-    } // end try
+    getField(FIRSTNAMEFIELD, nameFirst);    // a missing name is left blank
+    getField(LASTNAMEFIELD, nameLast);
 
     output << "  *** Customer ID = " << customerID << "  " << nameFirst
            << ' ' << nameLast << endl;
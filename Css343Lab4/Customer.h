@@ -11,7 +11,10 @@
 #ifndef _CUSTOMER_H
 #define	_CUSTOMER_H
 
+#include <atomic>
+#include "FieldAtom.h"
 #include "History.h"
+#include "KeyedItem.h"
 #include "ThreadedBST.h"
 
 
@@ -79,13 +82,36 @@ public:
  * @param target  A key-value pair whose key matches a key in this Customer's
  *                information. Will be updated with the corresponding value, if
  *                found.
- * @pre This Customer has a value in the specified field.
- * @post target contains the located value.
+ * @pre None.
+ * @post target contains the located value. A missing field is counted rather
+ *       than reported.
  * @return true if this Customer has a value in the specified field and target
  *         was updated with that value; false, otherwise.
  */
     bool getField(KeyedItem& target) const;
 
+/**---------------------- getField() (Atom) ----------------------------------
+ * Retrieves the value of a specified field of this Customer's information by
+ * the atom of its name, without building a KeyedItem or comparing strings.
+ * @param field  The atom of the field to look up.
+ * @param fieldValue  A container for the corresponding value, if found.
+ * @pre None.
+ * @post fieldValue contains the located value. A missing field is counted
+ *       rather than reported.
+ * @return true if this Customer has a value in the specified field and
+ *         fieldValue was updated with that value; false, otherwise.
+ */
+    bool getField(FieldID field, ValueType& fieldValue) const;
+
+/**---------------------- getFieldMisses() ------------------------------------
+ * Retrieves the number of times getField() has not found a field in any
+ * Customer since the program started.
+ * @pre None.
+ * @post None.
+ * @return The number of fields looked up and not found.
+ */
+    static int getFieldMisses(void);
+
 /**---------------------- setField() ------------------------------------------
  * Sets the value of a specified field of this Customer's information to a
  * specified value. If the field does not exist, it is created. Once a field
@@ -98,6 +124,16 @@ public:
  */
     void setField(const KeyedItem& newValue);
 
+/**---------------------- setField() (Atom) ----------------------------------
+ * Sets the value of a specified field of this Customer's information by the
+ * atom of its name. If the field does not exist, it is created.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to store in the field.
+ * @pre None.
+ * @post This Customer contains the field with the value newValue.
+ */
+    void setField(FieldID field, const ValueType& newValue);
+
 /**---------------------- displayInfo() ---------------------------------------
  * Writes the information of this Customer to an output stream.
  * @param output  The output stream to which information will be written.
@@ -161,7 +197,9 @@ private:
 
     int         customerID;     // identifier unique within a business
     History     activity;       // history of transactions with a business
-    ThreadedBST info;           // customer identifying information
+    ThreadedBST<FieldID, ValueType> info;   // identifying information
+
+    static atomic<int> fieldMisses; // fields not found, in any Customer
 
 }; // end class Customer
 
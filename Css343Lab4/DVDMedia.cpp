@@ -5,28 +5,151 @@
  *          of merchandise that keeps track of the quantity that a shop keeps
  *          in stock and how many it currently has on hand. It also introduces
  *          a method for updating its ancestor's search key according to rules
- *          that should be defined in a derived class.
+ *          that should be defined in a derived class. The title, director and
+ *          year that every movie has are kept in typed members rather than in
+ *          the field tree, and the item code is fixed by the derived class.
+ *          Text members refer to the shared StringArena, so a movie and all
+ *          of its copies share one stored copy of each name.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
 
+#include <sstream>
 #include "DVDMedia.h"
 
 
-DVDMedia::DVDMedia()
+DVDMedia::DVDMedia() : year(0)
 {
 } // end Default Constructor
 
-DVDMedia::DVDMedia(const string& searchKey) : Merch(searchKey)
+DVDMedia::DVDMedia(const string& searchKey) : Merch(searchKey), year(0)
 {
 } // end Constructor (Key)
 
 DVDMedia::DVDMedia(const KeyType& newKey, const KeyType& newValue,
                      int newStockQty, int newOnHandQty) :
-             Merch(newKey, newValue, newStockQty, newOnHandQty)
+             Merch(newKey, newValue, newStockQty, newOnHandQty), year(0)
 {
 } // end Constructor
 
 DVDMedia::~DVDMedia()
 {
 } // end Destructor
+
+void DVDMedia::assign(const Merch& source)
+{
+    const DVDMedia *movie = dynamic_cast<const DVDMedia*>(&source);
+
+    Merch::assign(source);
+
+    if (movie != NULL)      // copy the typed members, too
+    {
+        title = movie->title;
+        director = movie->director;
+        year = movie->year;
+    } // end if (movie != NULL)
+} // end assign(Merch&)
+
+bool DVDMedia::readField(FieldID field, ValueType& fieldValue) const
+{
+    switch (field)
+    {
+        case ITEMCODEFIELD:
+            fieldValue = itemCode();
+            return true;
+        case TITLEFIELD:
+            fieldValue = title.str();
+            return !title.empty();
+        case DIRECTORFIELD:
+            fieldValue = director.str();
+            return !director.empty();
+        case YEARFIELD:
+            fieldValue = numberText(year);
+            return year != 0;
+        default:
+            return Merch::readField(field, fieldValue);
+    } // end switch (field)
+} // end readField(FieldID, ValueType&)
+
+bool DVDMedia::writeField(FieldID field, ValueType& newValue)
+{
+    int number;
+
+    switch (field)
+    {
+        case ITEMCODEFIELD:
+            return true;        // fixed by the derived class
+        case TITLEFIELD:
+            title = StringArena::shared().intern(newValue);
+            return true;
+        case DIRECTORFIELD:
+            director = StringArena::shared().intern(newValue);
+            return true;
+        case YEARFIELD:
+            // a year that does not fit is kept as text in the field tree
+            year = (parseNumber(newValue, UINT16_MAX, number) ? number : 0);
+            return year != 0;
+        default:
+            return Merch::writeField(field, newValue);
+    } // end switch (field)
+} // end writeField(FieldID, ValueType&)
+
+TextRef DVDMedia::getTitle(void) const
+{
+    return title;
+} // end getTitle()
+
+TextRef DVDMedia::getDirector(void) const
+{
+    return director;
+} // end getDirector()
+
+int DVDMedia::getYear(void) const
+{
+    return year;
+} // end getYear()
+
+bool DVDMedia::parseNumber(const ValueType& text, int maxValue, int& number)
+{
+    int value = 0;
+
+    if (text.empty())
+    {
+        return false;
+    } // end if (text.empty())
+
+    for (size_t i = 0; i < text.length(); ++i)
+    {
+        if (text[i] < '0' || text[i] > '9')
+        {
+            return false;   // not a whole number
+        } // end if (text[i] < '0' || text[i] > '9')
+
+        value = value * 10 + (text[i] - '0');
+
+        if (value > maxValue)
+        {
+            return false;   // too large for the member that would hold it
+        } // end if (value > maxValue)
+    } // end for (i < text.length())
+
+    if (value == 0)
+    {
+        return false;       // 0 marks a member that has not been set
+    } // end if (value == 0)
+
+    number = value;
+    return true;
+} // end parseNumber(ValueType&, int, int&)
+
+ValueType DVDMedia::numberText(int number)
+{
+    ostringstream text;
+
+    if (number != 0)
+    {
+        text << number;
+    } // end if (number != 0)
+
+    return text.str();
+} // end numberText(int)
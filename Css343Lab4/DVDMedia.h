@@ -5,7 +5,11 @@
  *          of merchandise that keeps track of the quantity that a shop keeps
  *          in stock and how many it currently has on hand. It also introduces
  *          a method for updating its ancestor's search key according to rules
- *          that should be defined in a derived class.
+ *          that should be defined in a derived class. The title, director and
+ *          year that every movie has are kept in typed members rather than in
+ *          the field tree, and the item code is fixed by the derived class.
+ *          Text members refer to the shared StringArena, so a movie and all
+ *          of its copies share one stored copy of each name.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
@@ -13,7 +17,9 @@
 #ifndef _DVDMEDIA_H
 #define	_DVDMEDIA_H
 
+#include <cstdint>
 #include "Merch.h"
+#include "StringArena.h"
 
 
 class DVDMedia : public Merch
@@ -29,12 +35,104 @@ public:
 
     ~DVDMedia();
 
+/**---------------------- assign() --------------------------------------------
+ * Copies another DVD into this one, including its title, director and year.
+ * @param source  The Merchandise to be copied; of the same class as this one.
+ * @pre None.
+ * @post This DVD has the search key, quantities and fields of source.
+ */
+    virtual void assign(const Merch& source);
+
     virtual DVDMedia* create(ifstream& infile) const = 0;
 
     virtual DVDMedia* create(ifstream& infile, char mediaCode) const = 0;
 
+protected:
+
+/**---------------------- readField() -----------------------------------------
+ * Retrieves the item code, title, director or year of this DVD from its typed
+ * members.
+ * @param field  The atom of the field to look up.
+ * @param fieldValue  A container for the value of the field, if found.
+ * @pre None.
+ * @post fieldValue contains the value of the field, if it is one of these and
+ *       has been set.
+ * @return true if fieldValue was updated; false, otherwise.
+ */
+    virtual bool readField(FieldID field, ValueType& fieldValue) const;
+
+/**---------------------- writeField() ----------------------------------------
+ * Stores the title, director or year of this DVD in its typed members. The
+ * item code is fixed by the derived class, so a new one is discarded.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to store; moved from if it is taken.
+ * @pre None.
+ * @post If the field is one of these, its member holds newValue. A year that
+ *       is not a number from 1 to 65535 is left to the field tree.
+ * @throw bad_alloc  If text cannot be stored in the shared arena.
+ * @return true if the value was taken; false, otherwise.
+ */
+    virtual bool writeField(FieldID field, ValueType& newValue);
+
+/**---------------------- itemCode() ------------------------------------------
+ * Retrieves the item code shared by every DVD of a derived class.
+ * @pre None.
+ * @post None.
+ * @return The item code of this kind of DVD.
+ */
+    virtual const char* itemCode(void) const = 0;
+
+/**---------------------- getTitle() ------------------------------------------
+ * Retrieves the title of this DVD without a field lookup.
+ * @pre None.
+ * @post None.
+ * @return A view of the title, which is empty if it has not been set.
+ */
+    TextRef getTitle(void) const;
+
+/**---------------------- getDirector() ---------------------------------------
+ * Retrieves the director of this DVD without a field lookup.
+ * @pre None.
+ * @post None.
+ * @return A view of the director, which is empty if it has not been set.
+ */
+    TextRef getDirector(void) const;
+
+/**---------------------- getYear() -------------------------------------------
+ * Retrieves the year of this DVD without a field lookup.
+ * @pre None.
+ * @post None.
+ * @return The year, or 0 if it has not been set.
+ */
+    int getYear(void) const;
+
+/**---------------------- parseNumber() ---------------------------------------
+ * Reads a field value that should hold a positive whole number.
+ * @param text  The value to read.
+ * @param maxValue  The largest number allowed.
+ * @param number  A container for the number read.
+ * @pre None.
+ * @post number holds the value of text, if it is valid.
+ * @return true if text is made only of digits and its value is from 1 to
+ *         maxValue; false, otherwise.
+ */
+    static bool parseNumber(const ValueType& text, int maxValue, int& number);
+
+/**---------------------- numberText() ----------------------------------------
+ * Writes a number held in a typed member as a field value.
+ * @param number  The number to write.
+ * @pre None.
+ * @post None.
+ * @return The digits of number, or an empty string if number is 0.
+ */
+    static ValueType numberText(int number);
+
 private:
 
+    TextRef   title;            // title of the movie, in the shared arena
+    TextRef   director;         // director of the movie, in the shared arena
+    uint16_t  year;             // year of release; 0 if not set
+
 }; // end class DVDMedia
 
 #endif	/* _DVDMEDIA_H */
@@ -10,22 +10,15 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <utility>
 #include "Drama.h"
 
 Drama::Drama()
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Drama");
-    setField(tempKey);
 } // end Default Constructor
 
 Drama::Drama(const string& searchKey) : DVDMedia(searchKey)
 {
-    KeyedItem tempKey("Item Code");
-
-    tempKey.setValue("Drama");
-    setField(tempKey);
 } // end Constructor
 
 Drama::~Drama()
@@ -34,24 +27,19 @@ Drama::~Drama()
 
 bool Drama::updateSearchKey(void)
 {
-    KeyedItem tempKey;
     string director, title, searchKey = "";
 
     try
     {
-        tempKey.setKey("Director");
-        getField(tempKey);
-        director = tempKey.getValue();
-
-        tempKey.setKey("Title");
-        getField(tempKey);
-        title = tempKey.getValue();
+        getField(DIRECTORFIELD, director);
+        getField(TITLEFIELD, title);
 
         searchKey += director;
         searchKey += ", ";
         searchKey += title;
 
         setSearchKey(searchKey);
+        setItemKey(ItemKey(getDirector(), 0, getTitle()));
     }
     catch (TreeException e)
     {
@@ -64,45 +52,15 @@ bool Drama::updateSearchKey(void)
 
 Merch* Drama::copy() const
 {
-    Merch *tempMerch = new Drama();
-    KeyedItem tempKey("Director");
-
-    tempMerch->setStockQty(getStockQty());
-    tempMerch->setOnHandQty(getOnHandQty());
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Title");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    tempMerch->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Drama");
-    tempMerch->setField(tempKey);
-
-    tempMerch->updateSearchKey();
-
-    return tempMerch;
+    // the typed fields are copied as members, the rest node for node
+    return new Drama(*this);
 } // end copy()
 
 void Drama::display(void) const
 {
-    KeyedItem tempKey("Title");
-
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 20);
-
-    tempKey.setKey("Director");
-    getField(tempKey);
-    cout << left << tempKey.getValue().substr(0, 15);
-
-    tempKey.setKey("Year");
-    getField(tempKey);
-    cout << right << setw(6) << tempKey.getValue();
+    cout << left << getTitle().substr(0, 20);
+    cout << left << getDirector().substr(0, 15);
+    cout << right << setw(6) << numberText(getYear());
 } // end display()
 
 void Drama::displayLine(void) const
@@ -116,21 +74,12 @@ void Drama::displayLine(void) const
 
 DVDMedia* Drama::create(ifstream& infile) const
 {
-    KeyedItem tempKey;
     Drama    *newDrama = new Drama;
     string    year;
 
     infile >> year;
 
-    tempKey.setKey("Year");
-    tempKey.setValue(year);
-
-    newDrama->setField(tempKey);
-
-    tempKey.setKey("Item Code");
-    tempKey.setValue("Drama");
-
-    newDrama->setField(tempKey);
+    newDrama->setField(YEARFIELD, move(year));
 
     return newDrama;
 } // end create()
@@ -151,3 +100,8 @@ DVDMedia* Drama::create(ifstream& infile, char mediaCode) const
 
     return NULL;
 } // end create()
+
+const char* Drama::itemCode(void) const
+{
+    return "Drama";
+} // end itemCode()
@@ -0,0 +1,75 @@
+/*
+ * @file    FieldAtom.cpp
+ * @brief   A registry of the field names used by Merch and Customer. Each name
+ *          is interned once and given a small integer atom, a FieldID, so the
+ *          field trees are keyed by int rather than by string. Finding a field
+ *          then takes one integer comparison per level, and a name is stored
+ *          once in the registry instead of in every node that uses it. The
+ *          fields known to this program are registered in alphabetical order
+ *          under fixed atoms, so they need no lookup at all and sort in the
+ *          same order as their names. Names interned later are given the next
+ *          free atom. The registry is not safe to grow from several threads.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#include "FieldAtom.h"
+
+
+FieldAtom::FieldAtom()
+{
+    // in the order of the fixed atoms, which is also alphabetical order
+    static const char *const FIXEDNAMES[] = { "Director", "First Name",
+                                              "Item Code", "Last Name",
+                                              "Major Actor", "Month",
+                                              "Title", "Year" };
+
+    for (size_t i = 0; i < sizeof(FIXEDNAMES) / sizeof(*FIXEDNAMES); ++i)
+    {
+        names.push_back(FIXEDNAMES[i]);
+        atoms.searchTreeInsert(names.back(), static_cast<FieldID>(i));
+    } // end for (i < sizeof(FIXEDNAMES) / sizeof(*FIXEDNAMES))
+} // end Constructor
+
+FieldID FieldAtom::intern(const KeyType& fieldName)
+{
+    FieldAtom &reg = registry();
+    FieldID    field = find(fieldName);
+
+    if (field == NOFIELD)   // new name; give it the next atom
+    {
+        field = static_cast<FieldID>(reg.names.size());
+        reg.names.push_back(fieldName);
+
+        try
+        {
+            reg.atoms.searchTreeInsert(fieldName, field);
+        }
+        catch (TreeException e)
+        {
+            reg.names.pop_back();   // leave the registry as it was
+            throw;
+        } // end try
+    } // end if (field == NOFIELD)
+
+    return field;
+} // end intern(KeyType&)
+
+FieldID FieldAtom::find(const KeyType& fieldName)
+{
+    const FieldID *field = registry().atoms.findMutable(fieldName);
+
+    return (field == NULL ? NOFIELD : *field);
+} // end find(KeyType&)
+
+const KeyType& FieldAtom::nameOf(FieldID field)
+{
+    return registry().names[field];
+} // end nameOf(FieldID)
+
+FieldAtom& FieldAtom::registry(void)
+{
+    static FieldAtom theRegistry;   // built on first use
+
+    return theRegistry;
+} // end registry()
@@ -0,0 +1,94 @@
+/*
+ * @file    FieldAtom.h
+ * @brief   A registry of the field names used by Merch and Customer. Each name
+ *          is interned once and given a small integer atom, a FieldID, so the
+ *          field trees are keyed by int rather than by string. Finding a field
+ *          then takes one integer comparison per level, and a name is stored
+ *          once in the registry instead of in every node that uses it. The
+ *          fields known to this program are registered in alphabetical order
+ *          under fixed atoms, so they need no lookup at all and sort in the
+ *          same order as their names. Names interned later are given the next
+ *          free atom. The registry is not safe to grow from several threads.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _FIELDATOM_H
+#define	_FIELDATOM_H
+
+#include <string>
+#include <vector>
+#include "KeyedItem.h"
+#include "ThreadedBST.h"
+
+typedef int FieldID;
+
+const FieldID NOFIELD = -1;         // atom of a name that is not registered
+const FieldID DIRECTORFIELD = 0;    // "Director"
+const FieldID FIRSTNAMEFIELD = 1;   // "First Name"
+const FieldID ITEMCODEFIELD = 2;    // "Item Code"
+const FieldID LASTNAMEFIELD = 3;    // "Last Name"
+const FieldID MAJORACTORFIELD = 4;  // "Major Actor"
+const FieldID MONTHFIELD = 5;       // "Month"
+const FieldID TITLEFIELD = 6;       // "Title"
+const FieldID YEARFIELD = 7;        // "Year"
+
+
+class FieldAtom
+{
+public:
+
+/**---------------------- intern() --------------------------------------------
+ * Retrieves the atom of a field name, registering the name if it is new.
+ * @param fieldName  The name of the field.
+ * @pre None.
+ * @post fieldName is registered.
+ * @return The atom of fieldName.
+ * @throw TreeException  If a new name cannot be registered.
+ */
+    static FieldID intern(const KeyType& fieldName);
+
+/**---------------------- find() ----------------------------------------------
+ * Retrieves the atom of a field name without registering it.
+ * @param fieldName  The name of the field.
+ * @pre None.
+ * @post None.
+ * @return The atom of fieldName, or NOFIELD if it is not registered.
+ */
+    static FieldID find(const KeyType& fieldName);
+
+/**---------------------- nameOf() --------------------------------------------
+ * Retrieves the name of a field from its atom.
+ * @param field  The atom of the field.
+ * @pre field was returned by intern() or is one of the fixed atoms.
+ * @post None.
+ * @return The name registered under field.
+ */
+    static const KeyType& nameOf(FieldID field);
+
+private:
+
+    typedef ThreadedBST<KeyType, FieldID> AtomTree;
+
+/**---------------------- Constructor -----------------------------------------
+ * Creates the registry and registers the fixed atoms in order.
+ * @pre None.
+ * @post The names of the fixed atoms are registered.
+ */
+    FieldAtom();
+
+/**---------------------- registry() ------------------------------------------
+ * Retrieves the one registry, creating it on first use so that it is ready
+ * before any other static object needs it.
+ * @pre None.
+ * @post The registry exists.
+ * @return The registry.
+ */
+    static FieldAtom& registry(void);
+
+    vector<KeyType> names;      // field names, indexed by atom
+    AtomTree        atoms;      // atoms, keyed by field name
+
+}; // end class FieldAtom
+
+#endif	/* _FIELDATOM_H */
@@ -0,0 +1,659 @@
+/*
+ * @file    FrozenBST.cpp
+ * @brief   A read-optimized snapshot of a threaded binary search tree. The
+ *          items of the tree are laid out in two arrays in Eytzinger order:
+ *          the root in slot 1 and the children of slot k in slots 2k and
+ *          2k + 1. A search touches the arrays from the front, where the top
+ *          levels of every search share the same few cache lines, and each
+ *          step down is computed from a comparison rather than branched on.
+ *          Inorder iteration steps between slots by index arithmetic, much as
+ *          the threads of a ThreadedBST lead from a node to its successor.
+ *          The layout itself is immutable. Insertions go to a small delta
+ *          tree that is merged into it by the next call to freeze(). Until
+ *          then, every search and iterator covers the layout and the delta
+ *          tree together, as if they were one tree. Being a template, this
+ *          file is included by FrozenBST.h rather than compiled on its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _FROZENBST_CPP
+#define	_FROZENBST_CPP
+
+#include <new>              // for bad_alloc
+#include <utility>          // for pair
+#include <vector>           // for the layout arrays
+
+#include "FrozenBST.h"
+
+using namespace std;
+
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::Inorder::Inorder(const FrozenBST *aTree,
+                                                 int aSlot, int aDeltaRank) :
+                      container(aTree), slot(aSlot), deltaRank(aDeltaRank),
+                      deltaPos(&aTree->delta, NULL)
+{
+    if (deltaRank < container->delta.getLength())
+    {
+        deltaPos = container->delta.select(deltaRank);
+    } // end if (deltaRank < container->delta.getLength())
+} // end constructor
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::Inorder::Inorder(const Inorder& orig) :
+                      container(orig.container), slot(orig.slot),
+                      deltaRank(orig.deltaRank), deltaPos(orig.deltaPos)
+{
+} // end copy constructor
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::Inorder::~Inorder()
+{
+    container = NULL;
+    slot = 0;
+} // end destructor
+
+/** Assign an existing iterator's position to this object.
+ * @param rhs  The iterator with the values to be assigned.
+ * @pre None
+ * @post This object is a duplicate of rhs. rhs is unchanged
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::Inorder::operator=(const Inorder& rhs)
+{
+    container = rhs.container;
+    slot = rhs.slot;
+    deltaRank = rhs.deltaRank;
+    deltaPos = rhs.deltaPos;
+} // end operator=(Inorder&)
+
+/** Obtain a reference to the value to which this iterator points.
+ * @pre This iterator points to a data item.
+ * @post None
+ */
+template <class Key, class Value, class Compare>
+const Value& FrozenBST<Key, Value, Compare>::Inorder::operator*(void) const
+{
+    return (inLayout() ? container->values[slot] : *deltaPos);
+} // end operator*(void)
+
+/** Obtain a reference to the key of the item this iterator points to.
+ * @pre This iterator points to a data item.
+ * @post None
+ */
+template <class Key, class Value, class Compare>
+const Key& FrozenBST<Key, Value, Compare>::Inorder::getKey(void) const
+{
+    return (inLayout() ? container->keys[slot] : deltaPos.getKey());
+} // end getKey(void)
+
+/** Move this iterator to the next inorder item in its container.
+ * @pre This iterator is not past the last inorder element.
+ * @post This iterator points to the inorder successor of its previous item,
+ *       or one step past end() if there was none.
+ * @return This iterator.
+ */
+template <class Key, class Value, class Compare>
+typename FrozenBST<Key, Value, Compare>::Inorder
+FrozenBST<Key, Value, Compare>::Inorder::operator++(void)
+{
+    if (inLayout())
+    {
+        slot = nextSlot(slot, container->length);
+    }
+    else
+    {
+        ++deltaPos;         // the last item of delta leads to NULL
+        ++deltaRank;
+    } // end if (inLayout())
+
+    return *this;
+} // end operator++(void)
+
+/** Move this iterator to the previous inorder item in its container.
+ * @pre This iterator is not already at the first inorder element.
+ * @post This iterator points to the inorder predecessor of its previous item.
+ *       From one step past end(), that is end().
+ * @return This iterator.
+ */
+template <class Key, class Value, class Compare>
+typename FrozenBST<Key, Value, Compare>::Inorder
+FrozenBST<Key, Value, Compare>::Inorder::operator--(void)
+// Algorithm note: The predecessor is the later of the items just before the
+// two cursors. Since the layout's item comes first among equal keys, the
+// delta item is taken when the keys are equal.
+{
+    int prev = (slot == 0 ? lastSlot(container->length) :
+                prevSlot(slot, container->length));
+    typename SourceTree::Inorder prevPos(deltaPos);
+
+    if (deltaRank > 0)
+    {
+        if (deltaRank == container->delta.getLength())
+        {
+            prevPos = container->delta.end();   // cursor is past the end
+        }
+        else
+        {
+            --prevPos;
+        } // end if (deltaRank == container->delta.getLength())
+    } // end if (deltaRank > 0)
+
+    if (prev != 0 && (deltaRank == 0 ||
+                      container->compare(prevPos.getKey(),
+                                         container->keys[prev])))
+    {
+        slot = prev;
+    }
+    else
+    {
+        deltaPos = prevPos;
+        --deltaRank;
+    } // end if (prev != 0 && ...)
+
+    return *this;
+} // end operator--(void)
+
+/** Compare this iterator for equality with another.
+ * @param rhs  The iterator with which to compare.
+ * @pre None.
+ * @post None.
+ * @return true if this iterator points to the same container and item as the
+ *         rhs iterator, false otherwise.
+ */
+template <class Key, class Value, class Compare>
+bool FrozenBST<Key, Value, Compare>::Inorder::operator==(
+                                             const Inorder& rhs) const
+{
+    return ((container == rhs.container) && (slot == rhs.slot) &&
+            (deltaRank == rhs.deltaRank));
+} // end operator==(Inorder&)
+
+/** Compare this iterator for inequality with another.
+ * @param rhs  The iterator with which to compare.
+ * @pre None.
+ * @post None.
+ * @return true if this iterator points to a different container or item than
+ *         the rhs iterator, false otherwise.
+ */
+template <class Key, class Value, class Compare>
+bool FrozenBST<Key, Value, Compare>::Inorder::operator!=(
+                                             const Inorder& rhs) const
+{
+    return !(*this == rhs);
+} // end operator!=(Inorder&)
+
+/** Determines which cursor holds the current item.
+ * @pre None.
+ * @post None.
+ * @return true if the item is in the layout; false if it is in the delta tree
+ *         or the iterator is past the end.
+ */
+template <class Key, class Value, class Compare>
+bool FrozenBST<Key, Value, Compare>::Inorder::inLayout(void) const
+{
+    if (slot == 0)
+    {
+        return false;       // layout cursor is past its end
+    } // end if (slot == 0)
+
+    // a delta item goes first only if its key is strictly less
+    return (deltaRank == container->delta.getLength() ||
+            !container->compare(deltaPos.getKey(), container->keys[slot]));
+} // end inLayout(void)
+// end Inorder
+
+
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::FrozenBST() : keys(1), values(1), length(0)
+{
+} // end default constructor
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::FrozenBST(const SourceTree& tree)
+             throw(TreeException) : keys(1), values(1), length(0)
+{
+    freeze(tree);
+} // end constructor
+
+template <class Key, class Value, class Compare>
+FrozenBST<Key, Value, Compare>::~FrozenBST()
+{
+} // end destructor
+
+/** Determines whether this snapshot and its delta tree are both empty.
+ * @pre None.
+ * @post None.
+ * @return true if there are no items; otherwise returns false.
+ */
+template <class Key, class Value, class Compare>
+bool FrozenBST<Key, Value, Compare>::isEmpty(void) const
+{
+    return (length == 0 && delta.isEmpty());
+} // end isEmpty()
+
+/** Counts the items in this snapshot, including its delta tree.
+ * @pre None.
+ * @post None.
+ * @return The number of items that can be retrieved.
+ */
+template <class Key, class Value, class Compare>
+int FrozenBST<Key, Value, Compare>::getLength(void) const
+{
+    return length + delta.getLength();
+} // end getLength()
+
+/** Replaces the contents of this object with a snapshot of a tree.
+ * @param tree  The tree whose items are copied.
+ * @pre None.
+ * @post The layout holds the items of tree and the delta tree is empty.
+ * @throw TreeException  If memory allocation fails; this object is left
+ *        unchanged.
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::freeze(const SourceTree& tree)
+                                     throw(TreeException)
+{
+    vector<Item>  items;
+    vector<Key>   newKeys;
+    vector<Value> newValues;
+
+    try
+    {
+        items.reserve(tree.getLength());
+        collect(tree, items);
+        layout(items, newKeys, newValues);
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: freeze cannot allocate memory");
+    } // end try
+
+    // nothing below can fail, so the old contents are replaced whole
+    keys.swap(newKeys);
+    values.swap(newValues);
+    length = int(items.size());
+    delta = DeltaTree();
+} // end freeze(SourceTree&)
+
+/** Merges the delta tree into the layout.
+ * @pre None.
+ * @post The layout holds every item and the delta tree is empty. Among equal
+ *       keys, items already in the layout come first.
+ * @throw TreeException  If memory allocation fails; this object is left
+ *        unchanged.
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::freeze(void)
+                                     throw(TreeException)
+{
+    vector<Item>  added;            // items of the delta tree
+    vector<Item>  items;            // merged items
+    vector<Key>   newKeys;
+    vector<Value> newValues;
+    size_t        next = 0;         // next item of added to merge
+
+    if (delta.isEmpty())
+    {
+        return;     // layout is already current
+    } // end if (delta.isEmpty())
+
+    try
+    {
+        collect(delta, added);
+        items.reserve(length + added.size());
+
+        for (int slot = firstSlot(length); slot != 0;
+             slot = nextSlot(slot, length))
+        {
+            // added items go after layout items with equal keys
+            while (next < added.size() &&
+                   compare(added[next].first, keys[slot]))
+            {
+                items.push_back(added[next++]);
+            } // end while (next < added.size() ...)
+
+            items.push_back(Item(keys[slot], values[slot]));
+        } // end for (int slot = firstSlot(length); ...)
+
+        items.insert(items.end(), added.begin() + next, added.end());
+        layout(items, newKeys, newValues);
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: freeze cannot allocate memory");
+    } // end try
+
+    keys.swap(newKeys);
+    values.swap(newValues);
+    length = int(items.size());
+    delta = DeltaTree();
+} // end freeze()
+
+/** Adds an item to the delta tree. The item can be retrieved, and is visited
+ *  by Inorder iterators, at once.
+ * @param newKey  The search key of the item to be added.
+ * @param newValue  The value to be stored under newKey.
+ * @pre None.
+ * @post newKey is in the delta tree.
+ * @throw TreeException  If memory allocation fails.
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::searchTreeInsert(const Key& newKey,
+                                                      const Value& newValue)
+                                     throw(TreeException)
+{
+    delta.searchTreeInsert(newKey, newValue);
+} // end searchTreeInsert(Key&, Value&)
+
+/** Retrieves an item with a given search key, looking in the delta tree first
+ *  and then in the layout.
+ * @param searchKey  The search key of the item to be located. May be of any
+ *        type that Compare can order against Key.
+ * @param treeValue  A container for the value of the found item.
+ * @pre searchKey is the search key of the item to be retrieved.
+ * @post If the retrieval was successful, treeValue contains the value of the
+ *       retrieved item.
+ * @throw TreeException  If no such item exists.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+void FrozenBST<Key, Value, Compare>::searchTreeRetrive(
+                                            const SearchKey& searchKey,
+                                            Value& treeValue) const
+                                     throw(TreeException)
+{
+    int slot = 0;
+
+    if (!delta.isEmpty())
+    {
+        typename SourceTree::Inorder index(delta.lowerBound(searchKey));
+
+        if (index != typename SourceTree::Inorder(&delta, NULL) &&
+            !compare(searchKey, index.getKey()))
+        {
+            treeValue = *index;     // delta holds the newest items
+            return;
+        } // end if (index != ...)
+    } // end if (!delta.isEmpty())
+
+    slot = layoutBound(searchKey);
+
+    if (slot == 0 || compare(searchKey, keys[slot]))
+    {
+        throw TreeException(
+                "TreeException: searchKey not found");
+    } // end if (slot == 0 ...)
+
+    treeValue = values[slot];
+} // end searchTreeRetrieve(SearchKey&, Value&)
+
+/** Locates the first item, in the layout or the delta tree, whose key is not
+ *  less than a given search key.
+ * @param searchKey  The search key at which to start. May be of any type that
+ *        Compare can order against Key.
+ * @pre None.
+ * @post None.
+ * @return An iterator to the located item. If every key is less than
+ *         searchKey, the iterator is one step past end() and must not be
+ *         dereferenced.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+typename FrozenBST<Key, Value, Compare>::Inorder
+FrozenBST<Key, Value, Compare>::lowerBound(const SearchKey& searchKey) const
+{
+    return Inorder(this, layoutBound(searchKey), delta.rank(searchKey));
+} // end lowerBound(SearchKey&)
+
+/** Finds the first slot of the layout whose key is not less than a given
+ *  search key.
+ * @param searchKey  The search key at which to start.
+ * @pre None.
+ * @post None.
+ * @return The located slot, or 0 if every key is less than searchKey.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+int FrozenBST<Key, Value, Compare>::layoutBound(
+                                        const SearchKey& searchKey) const
+// Algorithm note: The descent always runs to the bottom of the layout, going
+// right exactly when the key in a slot is less than searchKey. The path taken
+// is recorded in the bits of slot, a 1 for each step right. The lower bound
+// is the last slot from which the path stepped left, so the trailing right
+// steps and that left step are shifted off at the end.
+{
+    int slot = 1;
+
+    while (slot <= length)
+    {
+        slot = 2 * slot + (compare(keys[slot], searchKey) ? 1 : 0);
+    } // end while (slot <= length)
+
+    while ((slot & 1) == 1)
+    {
+        slot >>= 1;     // undo trailing steps to the right
+    } // end while ((slot & 1) == 1)
+
+    return slot >> 1;
+} // end layoutBound(SearchKey&)
+
+/** Returns an iterator for the inorder first element.
+ * @pre This object is not empty.
+ * @post None.
+ * @return An iterator that can access the element, in the layout or the delta
+ *         tree, with the lowest key value.
+ * @throw TreeException  If both the layout and the delta tree are empty.
+ */
+template <class Key, class Value, class Compare>
+typename FrozenBST<Key, Value, Compare>::Inorder
+FrozenBST<Key, Value, Compare>::begin(void) const
+                                throw(TreeException)
+{
+    if (isEmpty())
+    {
+        throw TreeException(
+                "TreeException: tree empty, cannot get begin()");
+    } // end if (isEmpty())
+
+    return Inorder(this, firstSlot(length), 0);
+} // end begin()
+
+/** Returns an iterator for the inorder last element.
+ * @pre This object is not empty.
+ * @post None.
+ * @return An iterator that can access the element, in the layout or the delta
+ *         tree, with the highest key value.
+ * @throw TreeException  If both the layout and the delta tree are empty.
+ */
+template <class Key, class Value, class Compare>
+typename FrozenBST<Key, Value, Compare>::Inorder
+FrozenBST<Key, Value, Compare>::end(void) const
+                                throw(TreeException)
+{
+    Inorder last(this, 0, delta.getLength());   // one step past the end
+
+    if (isEmpty())
+    {
+        throw TreeException(
+                "TreeException: tree empty, cannot get end()");
+    } // end if (isEmpty())
+
+    --last;
+    return last;
+} // end end()
+
+/** Lays out a sorted sequence of items in Eytzinger order.
+ * @param items  The items to lay out, in nondecreasing key order.
+ * @param newKeys  A container for the keys of the layout.
+ * @param newValues  A container for the values of the layout.
+ * @pre None.
+ * @post newKeys and newValues hold items.size() + 1 slots, and walking them
+ *       inorder visits items in sequence.
+ * @throw bad_alloc  If the layout cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::layout(const vector<Item>& items,
+                                            vector<Key>& newKeys,
+                                            vector<Value>& newValues)
+{
+    int size = int(items.size());
+    int slot = firstSlot(size);
+
+    newKeys.resize(size + 1);
+    newValues.resize(size + 1);
+
+    for (int i = 0; i < size; ++i)
+    {
+        newKeys[slot] = items[i].first;
+        newValues[slot] = items[i].second;
+        slot = nextSlot(slot, size);
+    } // end for (i < size)
+} // end layout(vector<Item>&, vector<Key>&, vector<Value>&)
+
+/** Appends the items of a threaded binary search tree in sorted order.
+ * @param tree  The tree whose items are copied.
+ * @param items  The container to which the items are appended.
+ * @pre None.
+ * @post items ends with the items of tree, in sorted order.
+ * @throw bad_alloc  If items cannot grow.
+ */
+template <class Key, class Value, class Compare>
+void FrozenBST<Key, Value, Compare>::collect(const SourceTree& tree,
+                                             vector<Item>& items)
+{
+    if (tree.isEmpty())
+    {
+        return;     // nothing to copy
+    } // end if (tree.isEmpty())
+
+    typename SourceTree::Inorder index(tree.begin());
+
+    for (;;)
+    {
+        items.push_back(Item(index.getKey(), *index));
+
+        if (index == tree.end())
+        {
+            break;      // last item copied
+        } // end if (index == tree.end())
+
+        ++index;
+    } // end for (;;)
+} // end collect(SourceTree&, vector<Item>&)
+
+/** Finds the first slot of an Eytzinger layout in inorder.
+ * @param size  The number of items in the layout.
+ * @pre None.
+ * @post None.
+ * @return The leftmost slot, or 0 if the layout is empty.
+ */
+template <class Key, class Value, class Compare>
+int FrozenBST<Key, Value, Compare>::firstSlot(int size)
+{
+    int slot = (size > 0 ? 1 : 0);
+
+    while (2 * slot <= size && slot != 0)
+    {
+        slot = 2 * slot;        // follow left children
+    } // end while (2 * slot <= size && slot != 0)
+
+    return slot;
+} // end firstSlot(int)
+
+/** Finds the last slot of an Eytzinger layout in inorder.
+ * @param size  The number of items in the layout.
+ * @pre None.
+ * @post None.
+ * @return The rightmost slot, or 0 if the layout is empty.
+ */
+template <class Key, class Value, class Compare>
+int FrozenBST<Key, Value, Compare>::lastSlot(int size)
+{
+    int slot = (size > 0 ? 1 : 0);
+
+    while (2 * slot + 1 <= size && slot != 0)
+    {
+        slot = 2 * slot + 1;    // follow right children
+    } // end while (2 * slot + 1 <= size && slot != 0)
+
+    return slot;
+} // end lastSlot(int)
+
+/** Finds the inorder successor of a slot in an Eytzinger layout.
+ * @param slot  The slot from which to step; 0 < slot <= size.
+ * @param size  The number of items in the layout.
+ * @pre None.
+ * @post None.
+ * @return The successor slot, or 0 if slot is the last in inorder.
+ */
+template <class Key, class Value, class Compare>
+int FrozenBST<Key, Value, Compare>::nextSlot(int slot, int size)
+{
+    if (2 * slot + 1 <= size)
+    {
+        // leftmost slot of the right subtree
+        slot = 2 * slot + 1;
+
+        while (2 * slot <= size)
+        {
+            slot = 2 * slot;
+        } // end while (2 * slot <= size)
+    }
+    else
+    {
+        // climb past right children; the parent of the first left child is
+        // the successor, and climbing off the root gives 0
+        while ((slot & 1) == 1)
+        {
+            slot >>= 1;
+        } // end while ((slot & 1) == 1)
+
+        slot >>= 1;
+    } // end if (2 * slot + 1 <= size)
+
+    return slot;
+} // end nextSlot(int, int)
+
+/** Finds the inorder predecessor of a slot in an Eytzinger layout.
+ * @param slot  The slot from which to step; 0 < slot <= size.
+ * @param size  The number of items in the layout.
+ * @pre None.
+ * @post None.
+ * @return The predecessor slot, or 0 if slot is the first in inorder.
+ */
+template <class Key, class Value, class Compare>
+int FrozenBST<Key, Value, Compare>::prevSlot(int slot, int size)
+{
+    if (2 * slot <= size)
+    {
+        // rightmost slot of the left subtree
+        slot = 2 * slot;
+
+        while (2 * slot + 1 <= size)
+        {
+            slot = 2 * slot + 1;
+        } // end while (2 * slot + 1 <= size)
+    }
+    else
+    {
+        // climb past left children; the parent of the first right child is
+        // the predecessor, and climbing off the root gives 0
+        while ((slot & 1) == 0)
+        {
+            slot >>= 1;
+        } // end while ((slot & 1) == 0)
+
+        slot >>= 1;
+    } // end if (2 * slot <= size)
+
+    return slot;
+} // end prevSlot(int, int)
+
+
+#endif	/* _FROZENBST_CPP */
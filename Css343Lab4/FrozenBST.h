@@ -0,0 +1,315 @@
+/*
+ * @file    FrozenBST.h
+ * @brief   A read-optimized snapshot of a threaded binary search tree. The
+ *          items of the tree are laid out in two arrays in Eytzinger order:
+ *          the root in slot 1 and the children of slot k in slots 2k and
+ *          2k + 1. A search touches the arrays from the front, where the top
+ *          levels of every search share the same few cache lines, and each
+ *          step down is computed from a comparison rather than branched on.
+ *          Inorder iteration steps between slots by index arithmetic, much as
+ *          the threads of a ThreadedBST lead from a node to its successor.
+ *          The layout itself is immutable. Insertions go to a small delta
+ *          tree that is merged into it by the next call to freeze(). Until
+ *          then, every search and iterator covers the layout and the delta
+ *          tree together, as if they were one tree.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _FROZENBST_H
+#define	_FROZENBST_H
+
+#include <utility>
+#include <vector>
+#include "AVLThreadedBST.h"
+#include "ThreadedBST.h"
+#include "TreeException.h"
+
+
+template <class Key, class Value, class Compare = KeyLess>
+class FrozenBST
+{
+public:
+
+    typedef ThreadedBST<Key, Value, Compare> SourceTree;
+
+    friend class Inorder;
+
+    /** An iterator over the layout and the delta tree at once. It keeps a
+     *  cursor into each and is at whichever item comes first; among equal
+     *  keys, the item of the layout comes first. An insertion invalidates
+     *  every iterator of the container.
+     */
+    class Inorder
+    {
+    public:
+
+        friend class FrozenBST;
+
+        Inorder(const FrozenBST *aTree, int aSlot, int aDeltaRank);
+
+        Inorder(const Inorder& orig);
+
+        virtual ~Inorder();
+
+        /** Assign an existing iterator's position to this object.
+         * @param rhs  The iterator with the values to be assigned.
+         * @pre None
+         * @post This object is a duplicate of rhs. rhs is unchanged
+         */
+        void operator=(const Inorder& rhs);
+
+        /** Obtain a reference to the value to which this iterator points.
+         * @pre This iterator points to a data item.
+         * @post None
+         */
+        const Value& operator*(void) const;
+
+        /** Obtain a reference to the key of the item this iterator points to.
+         * @pre This iterator points to a data item.
+         * @post None
+         */
+        const Key& getKey(void) const;
+
+        /** Move this iterator to the next inorder item in its container.
+         * @pre This iterator is not past the last inorder element.
+         * @post This iterator points to the inorder successor of its previous
+         *       item, or one step past end() if there was none.
+         * @return This iterator.
+         */
+        Inorder operator++(void);
+
+        /** Move this iterator to the previous inorder item in its container.
+         * @pre This iterator is not already at the first inorder element.
+         * @post This iterator points to the inorder predecessor of its
+         *       previous item. From one step past end(), that is end().
+         * @return This iterator.
+         */
+        Inorder operator--(void);
+
+        /** Compare this iterator for equality with another.
+         * @param rhs  The iterator with which to compare.
+         * @pre None.
+         * @post None.
+         * @return true if this iterator points to the same container and
+         *         item as the rhs iterator, false otherwise.
+         */
+        bool operator==(const Inorder& rhs) const;
+
+        /** Compare this iterator for inequality with another.
+         * @param rhs  The iterator with which to compare.
+         * @pre None.
+         * @post None.
+         * @return true if this iterator points to a different container or
+         *         item than the rhs iterator, false otherwise.
+         */
+        bool operator!=(const Inorder& rhs) const;
+
+    private:
+
+        const FrozenBST *container;     // containing object
+        int              slot;          // layout cursor; 0 is past the end
+        int              deltaRank;     // items of delta before its cursor
+        typename SourceTree::Inorder deltaPos;  // delta cursor; NULL at end
+
+        /** Determines which cursor holds the current item.
+         * @pre None.
+         * @post None.
+         * @return true if the item is in the layout; false if it is in the
+         *         delta tree or the iterator is past the end.
+         */
+        bool inLayout(void) const;
+
+    }; // end Inorder
+
+
+
+ // constructors and destructor:
+    FrozenBST();
+
+    /** Creates a frozen snapshot of a threaded binary search tree.
+     * @param tree  The tree whose items are copied.
+     * @pre None.
+     * @post This object holds the items of tree; tree is unchanged.
+     * @throw TreeException  If memory allocation fails.
+     */
+    explicit FrozenBST(const SourceTree& tree)
+             throw(TreeException);
+
+    virtual ~FrozenBST();
+
+    /** Determines whether this snapshot and its delta tree are both empty.
+     * @pre None.
+     * @post None.
+     * @return true if there are no items; otherwise returns false.
+     */
+    bool isEmpty(void) const;
+
+    /** Counts the items in this snapshot, including its delta tree.
+     * @pre None.
+     * @post None.
+     * @return The number of items that can be retrieved.
+     */
+    int getLength(void) const;
+
+    /** Replaces the contents of this object with a snapshot of a tree.
+     * @param tree  The tree whose items are copied.
+     * @pre None.
+     * @post The layout holds the items of tree and the delta tree is empty.
+     * @throw TreeException  If memory allocation fails; this object is left
+     *        unchanged.
+     */
+    void freeze(const SourceTree& tree)
+         throw(TreeException);
+
+    /** Merges the delta tree into the layout.
+     * @pre None.
+     * @post The layout holds every item and the delta tree is empty. Among
+     *       equal keys, items already in the layout come first.
+     * @throw TreeException  If memory allocation fails; this object is left
+     *        unchanged.
+     */
+    void freeze(void)
+         throw(TreeException);
+
+    /** Adds an item to the delta tree. The item can be retrieved, and is
+     *  visited by Inorder iterators, at once.
+     * @param newKey  The search key of the item to be added.
+     * @param newValue  The value to be stored under newKey.
+     * @pre None.
+     * @post newKey is in the delta tree.
+     * @throw TreeException  If memory allocation fails.
+     */
+    void searchTreeInsert(const Key& newKey, const Value& newValue)
+         throw(TreeException);
+
+    /** Retrieves an item with a given search key, looking in the delta tree
+     *  first and then in the layout.
+     * @param searchKey  The search key of the item to be located. May be of
+     *        any type that Compare can order against Key.
+     * @param treeValue  A container for the value of the found item.
+     * @pre searchKey is the search key of the item to be retrieved.
+     * @post If the retrieval was successful, treeValue contains the value of
+     *       the retrieved item.
+     * @throw TreeException  If no such item exists.
+     */
+    template <class SearchKey>
+    void searchTreeRetrive(const SearchKey& searchKey,
+                           Value& treeValue) const
+         throw(TreeException);
+
+    /** Locates the first item, in the layout or the delta tree, whose key is
+     *  not less than a given search key.
+     * @param searchKey  The search key at which to start. May be of any type
+     *        that Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return An iterator to the located item. If every key is less than
+     *         searchKey, the iterator is one step past end() and must not be
+     *         dereferenced.
+     */
+    template <class SearchKey>
+    Inorder lowerBound(const SearchKey& searchKey) const;
+
+    /** Returns an iterator for the inorder first element.
+     * @pre This object is not empty.
+     * @post None.
+     * @return An iterator that can access the element, in the layout or the
+     *         delta tree, with the lowest key value.
+     * @throw TreeException  If both the layout and the delta tree are empty.
+     */
+    Inorder begin(void) const
+            throw(TreeException);
+
+    /** Returns an iterator for the inorder last element.
+     * @pre This object is not empty.
+     * @post None.
+     * @return An iterator that can access the element, in the layout or the
+     *         delta tree, with the highest key value.
+     * @throw TreeException  If both the layout and the delta tree are empty.
+     */
+    Inorder end(void) const
+            throw(TreeException);
+
+private:
+
+    typedef pair<Key, Value> Item;
+    typedef AVLThreadedBST<Key, Value, Compare> DeltaTree;
+
+    vector<Key>   keys;         // search keys in Eytzinger order; slot 0 unused
+    vector<Value> values;       // values in the same slots as their keys
+    int           length;       // number of items in the layout
+    DeltaTree     delta;        // items inserted since the last freeze()
+    Compare       compare;      // ordering of keys
+
+    /** Finds the first slot of the layout whose key is not less than a given
+     *  search key.
+     * @param searchKey  The search key at which to start.
+     * @pre None.
+     * @post None.
+     * @return The located slot, or 0 if every key is less than searchKey.
+     */
+    template <class SearchKey>
+    int layoutBound(const SearchKey& searchKey) const;
+
+    /** Lays out a sorted sequence of items in Eytzinger order.
+     * @param items  The items to lay out, in nondecreasing key order.
+     * @param newKeys  A container for the keys of the layout.
+     * @param newValues  A container for the values of the layout.
+     * @pre None.
+     * @post newKeys and newValues hold items.size() + 1 slots, and walking
+     *       them inorder visits items in sequence.
+     * @throw bad_alloc  If the layout cannot be allocated.
+     */
+    static void layout(const vector<Item>& items, vector<Key>& newKeys,
+                       vector<Value>& newValues);
+
+    /** Appends the items of a threaded binary search tree in sorted order.
+     * @param tree  The tree whose items are copied.
+     * @param items  The container to which the items are appended.
+     * @pre None.
+     * @post items ends with the items of tree, in sorted order.
+     * @throw bad_alloc  If items cannot grow.
+     */
+    static void collect(const SourceTree& tree, vector<Item>& items);
+
+    /** Finds the first slot of an Eytzinger layout in inorder.
+     * @param size  The number of items in the layout.
+     * @pre None.
+     * @post None.
+     * @return The leftmost slot, or 0 if the layout is empty.
+     */
+    static int firstSlot(int size);
+
+    /** Finds the last slot of an Eytzinger layout in inorder.
+     * @param size  The number of items in the layout.
+     * @pre None.
+     * @post None.
+     * @return The rightmost slot, or 0 if the layout is empty.
+     */
+    static int lastSlot(int size);
+
+    /** Finds the inorder successor of a slot in an Eytzinger layout.
+     * @param slot  The slot from which to step; 0 < slot <= size.
+     * @param size  The number of items in the layout.
+     * @pre None.
+     * @post None.
+     * @return The successor slot, or 0 if slot is the last in inorder.
+     */
+    static int nextSlot(int slot, int size);
+
+    /** Finds the inorder predecessor of a slot in an Eytzinger layout.
+     * @param slot  The slot from which to step; 0 < slot <= size.
+     * @param size  The number of items in the layout.
+     * @pre None.
+     * @post None.
+     * @return The predecessor slot, or 0 if slot is the first in inorder.
+     */
+    static int prevSlot(int slot, int size);
+
+}; // end FrozenBST
+
+
+#include "FrozenBST.cpp"
+
+#endif	/* _FROZENBST_H */
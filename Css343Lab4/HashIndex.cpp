@@ -0,0 +1,482 @@
+/*
+ * @file    HashIndex.cpp
+ * @brief   An unordered index from search keys to values, for lookups by a
+ *          whole key. Items are kept in one array of slots and found by open
+ *          addressing: a key hashes to a home slot, and an item whose home
+ *          slot is taken goes in the next free slot after it. The array is
+ *          kept at most half full, so a lookup inspects a few neighbouring
+ *          slots whatever the number of items. Removal moves later items of
+ *          the same run back into the gap, so no slot is ever marked as
+ *          deleted. When the index must grow, a larger array is allocated and
+ *          the items are moved into it a few runs at a time, by each later
+ *          change, rather than all at once; until they all have moved, a
+ *          lookup that misses in the new array looks in the old one. Each key
+ *          is held at most once. The order of the items is not defined; use a
+ *          search tree to list them. Being a template, this file is included
+ *          by HashIndex.h rather than compiled on its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _HASHINDEX_CPP
+#define	_HASHINDEX_CPP
+
+#include <cstddef>          // definition of NULL
+#include <new>              // for bad_alloc
+#include <vector>           // for the arrays of slots
+
+#include "HashIndex.h"
+
+using namespace std;
+
+
+template <class Key, class Value, class Hash>
+HashIndex<Key, Value, Hash>::Slot::Slot() :
+                      key(), value(), hashCode(0), used(false)
+{
+} // end constructor
+
+template <class Key, class Value, class Hash>
+HashIndex<Key, Value, Hash>::HashIndex(int expectedQty) :
+        slots(capacityFor(expectedQty > 0 ? expectedQty : 0)),
+        mask(slots.size() - 1), length(0), oldMask(0), oldLength(0),
+        oldStart(0), moved(0)
+{
+} // end constructor
+
+template <class Key, class Value, class Hash>
+HashIndex<Key, Value, Hash>::~HashIndex()
+{
+} // end destructor
+
+/** Determines whether this index is empty.
+ * @pre None.
+ * @post None.
+ * @return true if the index is empty; otherwise returns false.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::isEmpty(void) const
+{
+    return length == 0;
+} // end isEmpty()
+
+/** Counts the items in this index.
+ * @pre None.
+ * @post None.
+ * @return The number of items in the index.
+ */
+template <class Key, class Value, class Hash>
+int HashIndex<Key, Value, Hash>::getLength(void) const
+{
+    return length;
+} // end getLength()
+
+/** Counts the slots of this index.
+ * @pre None.
+ * @post None.
+ * @return The number of slots, always a power of two. While a rehash is
+ *         under way, the slots of the array being filled.
+ */
+template <class Key, class Value, class Hash>
+int HashIndex<Key, Value, Hash>::getCapacity(void) const
+{
+    return static_cast<int>(slots.size());
+} // end getCapacity()
+
+/** Determines whether items are still being moved to a larger array.
+ * @pre None.
+ * @post None.
+ * @return true if some items are still in the old array; otherwise
+ *         returns false.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::isRehashing(void) const
+{
+    return !oldSlots.empty();
+} // end isRehashing()
+
+/** Adds an item to this index, unless its key is already held.
+ * @param newKey  The search key of the item to be added.
+ * @param newValue  The value to be stored under newKey.
+ * @pre None.
+ * @post If newKey was not in the index, it is now, with newValue.
+ *       Otherwise the index is unchanged. A few items may have moved to a
+ *       larger array either way.
+ * @return true if the item was added; false if newKey was already held.
+ * @throw TreeException  If the index must grow and memory allocation
+ *        fails; newKey is not added.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::insert(const Key& newKey,
+                                         const Value& newValue)
+                                 throw(TreeException)
+{
+    size_t hashCode = hasher(newKey);
+    size_t slot;
+
+    moveItems(REHASHSTEP);
+
+    if (findItem(newKey, hashCode) != NULL)
+    {
+        return false;           // already held
+    } // end if (findItem(newKey, hashCode) != NULL)
+
+    if (2 * static_cast<size_t>(length + 1) > slots.size())
+    {
+        // a rehash still under way when the new array fills is finished
+        // at once; this is rare, as each change moves REHASHSTEP slots
+        moveItems(oldSlots.size());
+
+        try
+        {
+            startRehash(slots.size() * 2);
+        }
+        catch (bad_alloc e)
+        {
+            throw TreeException(
+                    "TreeException: insert cannot allocate memory");
+        } // end try
+
+        moveItems(REHASHSTEP);
+    } // end if (2 * (length + 1) > slots.size())
+
+    // new items always go in the newest array
+    slot = findSlot(slots, mask, newKey, hashCode);
+    slots[slot].key = newKey;
+    slots[slot].value = newValue;
+    slots[slot].hashCode = hashCode;
+    slots[slot].used = true;
+    ++length;
+
+    return true;
+} // end insert(Key&, Value&)
+
+/** Replaces the value stored under a key that is already held.
+ * @param searchKey  The search key of the item to be changed.
+ * @param newValue  The value to be stored under searchKey.
+ * @pre None.
+ * @post If searchKey was in the index, newValue is stored under it.
+ *       Otherwise the index is unchanged.
+ * @return true if searchKey was found; false, otherwise.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::update(const Key& searchKey,
+                                         const Value& newValue)
+{
+    Slot *item = const_cast<Slot*>(findItem(searchKey, hasher(searchKey)));
+
+    if (item == NULL)
+    {
+        return false;
+    } // end if (item == NULL)
+
+    item->value = newValue;
+    return true;
+} // end update(Key&, Value&)
+
+/** Removes an item from this index.
+ * @param searchKey  The search key of the item to be removed.
+ * @pre None.
+ * @post searchKey is not in the index. A few items may have moved to a
+ *       larger array.
+ * @return true if searchKey was found and removed; false, otherwise.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::remove(const Key& searchKey)
+{
+    size_t hashCode = hasher(searchKey);
+    size_t slot;
+
+    moveItems(REHASHSTEP);
+
+    slot = findSlot(slots, mask, searchKey, hashCode);
+
+    if (slots[slot].used)
+    {
+        eraseSlot(slots, mask, slot);
+        --length;
+        return true;
+    } // end if (slots[slot].used)
+
+    if (oldSlots.empty())
+    {
+        return false;
+    } // end if (oldSlots.empty())
+
+    slot = findSlot(oldSlots, oldMask, searchKey, hashCode);
+
+    if (!oldSlots[slot].used)
+    {
+        return false;
+    } // end if (!oldSlots[slot].used)
+
+    eraseSlot(oldSlots, oldMask, slot);
+    --oldLength;
+    --length;
+
+    return true;
+} // end remove(Key&)
+
+/** Retrieves the value stored under a key.
+ * @param searchKey  The search key of the item to be located.
+ * @param indexValue  A container for the value of the found item.
+ * @pre None.
+ * @post If the retrieval was successful, indexValue contains the value of
+ *       the retrieved item; otherwise, indexValue is unchanged.
+ * @return true if an item has searchKey; false, otherwise.
+ */
+template <class Key, class Value, class Hash>
+bool HashIndex<Key, Value, Hash>::tryRetrieve(const Key& searchKey,
+                                              Value& indexValue) const
+{
+    const Slot *item = findItem(searchKey, hasher(searchKey));
+
+    if (item == NULL)
+    {
+        return false;
+    } // end if (item == NULL)
+
+    indexValue = item->value;
+    return true;
+} // end tryRetrieve(Key&, Value&)
+
+/** Makes room for a number of items at once, rather than growing a step
+ *  at a time as they are added. The items are moved to the larger array
+ *  by later changes, as when the index grows by itself.
+ * @param expectedQty  The number of items to make room for.
+ * @pre None.
+ * @post The index holds expectedQty items without growing again.
+ * @throw TreeException  If memory allocation fails; the index keeps its
+ *        size.
+ */
+template <class Key, class Value, class Hash>
+void HashIndex<Key, Value, Hash>::reserve(int expectedQty)
+                                 throw(TreeException)
+{
+    size_t newCapacity = capacityFor(expectedQty > length ?
+                                     expectedQty : length);
+
+    if (newCapacity <= slots.size())
+    {
+        return;                 // already room enough
+    } // end if (newCapacity <= slots.size())
+
+    moveItems(oldSlots.size());     // only one rehash at a time
+
+    try
+    {
+        startRehash(newCapacity);
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException("TreeException: reserve cannot allocate memory");
+    } // end try
+
+    moveItems(REHASHSTEP);
+} // end reserve(int)
+
+/** Removes every item from this index.
+ * @pre None.
+ * @post The index is empty. The slots of its newest array are kept for
+ *       reuse.
+ */
+template <class Key, class Value, class Hash>
+void HashIndex<Key, Value, Hash>::clear(void)
+{
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        slots[i] = Slot();
+    } // end for (i < slots.size())
+
+    vector<Slot>().swap(oldSlots);      // release the old array
+    oldLength = 0;
+    length = 0;
+} // end clear()
+
+/** Finds the item with a key in either array.
+ * @param searchKey  The search key of the item to be located.
+ * @param hashCode  The hash of searchKey.
+ * @pre None.
+ * @post None.
+ * @return The slot holding searchKey, or NULL if neither array holds it.
+ */
+template <class Key, class Value, class Hash>
+const typename HashIndex<Key, Value, Hash>::Slot*
+HashIndex<Key, Value, Hash>::findItem(const Key& searchKey,
+                                      size_t hashCode) const
+{
+    size_t slot = findSlot(slots, mask, searchKey, hashCode);
+
+    if (slots[slot].used)
+    {
+        return &slots[slot];
+    } // end if (slots[slot].used)
+
+    if (!oldSlots.empty())      // not moved yet, perhaps
+    {
+        slot = findSlot(oldSlots, oldMask, searchKey, hashCode);
+
+        if (oldSlots[slot].used)
+        {
+            return &oldSlots[slot];
+        } // end if (oldSlots[slot].used)
+    } // end if (!oldSlots.empty())
+
+    return NULL;
+} // end findItem(Key&, size_t)
+
+/** Finds the slot of an array that holds a key.
+ * @param table  The array to search.
+ * @param tableMask  table.size() - 1.
+ * @param searchKey  The search key of the item to be located.
+ * @param hashCode  The hash of searchKey.
+ * @pre table is not full.
+ * @post None.
+ * @return The slot holding searchKey, or the unused slot at which the
+ *         search for it stopped.
+ */
+template <class Key, class Value, class Hash>
+size_t HashIndex<Key, Value, Hash>::findSlot(const vector<Slot>& table,
+                                             size_t tableMask,
+                                             const Key& searchKey,
+                                             size_t hashCode)
+{
+    size_t slot = hashCode & tableMask;
+
+    // the array is never full, so the run ends at an unused slot
+    while (table[slot].used && (table[slot].hashCode != hashCode ||
+                                !(table[slot].key == searchKey)))
+    {
+        slot = (slot + 1) & tableMask;
+    } // end while (slot holds another key)
+
+    return slot;
+} // end findSlot(vector<Slot>&, size_t, Key&, size_t)
+
+/** Empties a slot of an array, moving later items of its run back so
+ *  that each can still be found from its home slot.
+ * @param table  The array that holds the slot.
+ * @param tableMask  table.size() - 1.
+ * @param gap  The slot to empty; it is used.
+ * @pre None.
+ * @post The item that was in slot gap is not in table.
+ */
+template <class Key, class Value, class Hash>
+void HashIndex<Key, Value, Hash>::eraseSlot(vector<Slot>& table,
+                                            size_t tableMask, size_t gap)
+{
+    size_t next;
+    size_t home;
+
+    // move back each later item of the run that may sit in the gap, which is
+    // any item whose home slot is not between the gap and where it sits
+    for (next = (gap + 1) & tableMask; table[next].used;
+         next = (next + 1) & tableMask)
+    {
+        home = table[next].hashCode & tableMask;
+
+        if (((next - home) & tableMask) >= ((next - gap) & tableMask))
+        {
+            table[gap] = table[next];
+            gap = next;
+        } // end if (item may move back to gap)
+    } // end for (table[next].used)
+
+    table[gap] = Slot();
+} // end eraseSlot(vector<Slot>&, size_t, size_t)
+
+/** Starts moving every item into a new array of slots.
+ * @param newCapacity  The number of slots of the new array; a power of
+ *        two that is at least twice the number of items.
+ * @pre No rehash is under way.
+ * @post The items are in oldSlots, to be moved by moveItems(), and slots
+ *       is an empty array of newCapacity slots.
+ * @throw bad_alloc  If the new array cannot be allocated; the index is
+ *        unchanged.
+ */
+template <class Key, class Value, class Hash>
+void HashIndex<Key, Value, Hash>::startRehash(size_t newCapacity)
+{
+    vector<Slot> newSlots(newCapacity);
+
+    oldSlots.swap(slots);
+    slots.swap(newSlots);
+    oldMask = mask;
+    mask = newCapacity - 1;
+    oldLength = length;
+    moved = 0;
+
+    // start at an unused slot, so that no run is split between the slots
+    // that have moved and those that have not; one exists, as the old array
+    // was never full
+    for (oldStart = 0; oldSlots[oldStart].used; ++oldStart)
+    {
+    } // end for (oldSlots[oldStart].used)
+} // end startRehash(size_t)
+
+/** Moves some items of the old array into the new one. Items are moved a
+ *  whole run at a time, so that the slots that remain in the old array
+ *  can still be searched.
+ * @param slotQty  The number of old slots to move, at least.
+ * @pre None.
+ * @post At least slotQty more slots of oldSlots, or all that were left,
+ *       have been moved. If none are left, oldSlots is released and no
+ *       rehash is under way.
+ */
+template <class Key, class Value, class Hash>
+void HashIndex<Key, Value, Hash>::moveItems(size_t slotQty)
+{
+    size_t oldSlot;
+    size_t slot;
+
+    while (oldLength > 0)
+    {
+        oldSlot = (oldStart + moved) & oldMask;
+        ++moved;
+
+        if (oldSlots[oldSlot].used)
+        {
+            slot = findSlot(slots, mask, oldSlots[oldSlot].key,
+                            oldSlots[oldSlot].hashCode);
+            slots[slot] = oldSlots[oldSlot];
+            oldSlots[oldSlot] = Slot();
+            --oldLength;
+        }
+        else if (slotQty <= 1)
+        {
+            break;              // the end of a run, with enough moved
+        } // end if (oldSlots[oldSlot].used)
+
+        if (slotQty > 0)
+        {
+            --slotQty;
+        } // end if (slotQty > 0)
+    } // end while (oldLength > 0)
+
+    if (oldLength == 0 && !oldSlots.empty())
+    {
+        vector<Slot>().swap(oldSlots);  // every item has moved
+    } // end if (oldLength == 0 && !oldSlots.empty())
+} // end moveItems(size_t)
+
+/** Finds the number of slots needed for a number of items.
+ * @param itemQty  The number of items.
+ * @pre None.
+ * @post None.
+ * @return The smallest power of two, at least MINHASHCAPACITY, that is
+ *         at least twice itemQty.
+ */
+template <class Key, class Value, class Hash>
+size_t HashIndex<Key, Value, Hash>::capacityFor(size_t itemQty)
+{
+    size_t capacity = MINHASHCAPACITY;
+
+    while (capacity < 2 * itemQty)
+    {
+        capacity *= 2;
+    } // end while (capacity < 2 * itemQty)
+
+    return capacity;
+} // end capacityFor(size_t)
+
+#endif	/* _HASHINDEX_CPP */
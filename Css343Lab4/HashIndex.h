@@ -0,0 +1,237 @@
+/*
+ * @file    HashIndex.h
+ * @brief   An unordered index from search keys to values, for lookups by a
+ *          whole key. Items are kept in one array of slots and found by open
+ *          addressing: a key hashes to a home slot, and an item whose home
+ *          slot is taken goes in the next free slot after it. The array is
+ *          kept at most half full, so a lookup inspects a few neighbouring
+ *          slots whatever the number of items. Removal moves later items of
+ *          the same run back into the gap, so no slot is ever marked as
+ *          deleted. When the index must grow, a larger array is allocated and
+ *          the items are moved into it a few runs at a time, by each later
+ *          change, rather than all at once; until they all have moved, a
+ *          lookup that misses in the new array looks in the old one. Each key
+ *          is held at most once. The order of the items is not defined; use a
+ *          search tree to list them.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _HASHINDEX_H
+#define	_HASHINDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "TreeException.h"
+
+using namespace std;
+
+const size_t MINHASHCAPACITY = 8;   // slots in the smallest index
+const size_t REHASHSTEP = 8;        // old slots moved by each change, at least
+
+
+template <class Key, class Value, class Hash = hash<Key> >
+class HashIndex
+{
+public:
+
+    /** Creates an empty index with room for a number of items.
+     * @param expectedQty  The number of items expected, or 0 if unknown.
+     * @pre None.
+     * @post An empty index exists that holds expectedQty items without
+     *       growing.
+     */
+    explicit HashIndex(int expectedQty = 0);
+
+    virtual ~HashIndex();
+
+    /** Determines whether this index is empty.
+     * @pre None.
+     * @post None.
+     * @return true if the index is empty; otherwise returns false.
+     */
+    bool isEmpty(void) const;
+
+    /** Counts the items in this index.
+     * @pre None.
+     * @post None.
+     * @return The number of items in the index.
+     */
+    int getLength(void) const;
+
+    /** Counts the slots of this index.
+     * @pre None.
+     * @post None.
+     * @return The number of slots, always a power of two. While a rehash is
+     *         under way, the slots of the array being filled.
+     */
+    int getCapacity(void) const;
+
+    /** Determines whether items are still being moved to a larger array.
+     * @pre None.
+     * @post None.
+     * @return true if some items are still in the old array; otherwise
+     *         returns false.
+     */
+    bool isRehashing(void) const;
+
+    /** Adds an item to this index, unless its key is already held.
+     * @param newKey  The search key of the item to be added.
+     * @param newValue  The value to be stored under newKey.
+     * @pre None.
+     * @post If newKey was not in the index, it is now, with newValue.
+     *       Otherwise the index is unchanged. A few items may have moved to a
+     *       larger array either way.
+     * @return true if the item was added; false if newKey was already held.
+     * @throw TreeException  If the index must grow and memory allocation
+     *        fails; newKey is not added.
+     */
+    bool insert(const Key& newKey, const Value& newValue)
+         throw(TreeException);
+
+    /** Replaces the value stored under a key that is already held.
+     * @param searchKey  The search key of the item to be changed.
+     * @param newValue  The value to be stored under searchKey.
+     * @pre None.
+     * @post If searchKey was in the index, newValue is stored under it.
+     *       Otherwise the index is unchanged.
+     * @return true if searchKey was found; false, otherwise.
+     */
+    bool update(const Key& searchKey, const Value& newValue);
+
+    /** Removes an item from this index.
+     * @param searchKey  The search key of the item to be removed.
+     * @pre None.
+     * @post searchKey is not in the index. A few items may have moved to a
+     *       larger array.
+     * @return true if searchKey was found and removed; false, otherwise.
+     */
+    bool remove(const Key& searchKey);
+
+    /** Retrieves the value stored under a key.
+     * @param searchKey  The search key of the item to be located.
+     * @param indexValue  A container for the value of the found item.
+     * @pre None.
+     * @post If the retrieval was successful, indexValue contains the value of
+     *       the retrieved item; otherwise, indexValue is unchanged.
+     * @return true if an item has searchKey; false, otherwise.
+     */
+    bool tryRetrieve(const Key& searchKey, Value& indexValue) const;
+
+    /** Makes room for a number of items at once, rather than growing a step
+     *  at a time as they are added. The items are moved to the larger array
+     *  by later changes, as when the index grows by itself.
+     * @param expectedQty  The number of items to make room for.
+     * @pre None.
+     * @post The index holds expectedQty items without growing again.
+     * @throw TreeException  If memory allocation fails; the index keeps its
+     *        size.
+     */
+    void reserve(int expectedQty)
+         throw(TreeException);
+
+    /** Removes every item from this index.
+     * @pre None.
+     * @post The index is empty. The slots of its newest array are kept for
+     *       reuse.
+     */
+    void clear(void);
+
+private:
+
+    /** One slot of the array. An unused slot holds a default Key and Value.
+     */
+    struct Slot
+    {
+        Slot();
+
+        Key    key;                 // search key
+        Value  value;               // data portion
+        size_t hashCode;            // hash of key, kept for rehashing
+        bool   used;                // whether the slot holds an item
+    }; // end Slot
+
+    vector<Slot> slots;         // the array; its size is a power of two
+    size_t       mask;          // slots.size() - 1, to wrap a slot number
+    int          length;        // number of items in both arrays
+    vector<Slot> oldSlots;      // array being emptied; empty if not rehashing
+    size_t       oldMask;       // oldSlots.size() - 1
+    int          oldLength;     // number of items left in oldSlots
+    size_t       oldStart;      // first slot of oldSlots to be moved
+    size_t       moved;         // slots of oldSlots moved from oldStart on
+    Hash         hasher;        // hash function of keys
+
+    // not copyable; the Inventory that owns an index is not either
+    HashIndex(const HashIndex& orig);
+    HashIndex& operator=(const HashIndex& rhs);
+
+    /** Finds the item with a key in either array.
+     * @param searchKey  The search key of the item to be located.
+     * @param hashCode  The hash of searchKey.
+     * @pre None.
+     * @post None.
+     * @return The slot holding searchKey, or NULL if neither array holds it.
+     */
+    const Slot* findItem(const Key& searchKey, size_t hashCode) const;
+
+    /** Finds the slot of an array that holds a key.
+     * @param table  The array to search.
+     * @param tableMask  table.size() - 1.
+     * @param searchKey  The search key of the item to be located.
+     * @param hashCode  The hash of searchKey.
+     * @pre table is not full.
+     * @post None.
+     * @return The slot holding searchKey, or the unused slot at which the
+     *         search for it stopped.
+     */
+    static size_t findSlot(const vector<Slot>& table, size_t tableMask,
+                           const Key& searchKey, size_t hashCode);
+
+    /** Empties a slot of an array, moving later items of its run back so
+     *  that each can still be found from its home slot.
+     * @param table  The array that holds the slot.
+     * @param tableMask  table.size() - 1.
+     * @param gap  The slot to empty; it is used.
+     * @pre None.
+     * @post The item that was in slot gap is not in table.
+     */
+    static void eraseSlot(vector<Slot>& table, size_t tableMask, size_t gap);
+
+    /** Starts moving every item into a new array of slots.
+     * @param newCapacity  The number of slots of the new array; a power of
+     *        two that is at least twice the number of items.
+     * @pre No rehash is under way.
+     * @post The items are in oldSlots, to be moved by moveItems(), and slots
+     *       is an empty array of newCapacity slots.
+     * @throw bad_alloc  If the new array cannot be allocated; the index is
+     *        unchanged.
+     */
+    void startRehash(size_t newCapacity);
+
+    /** Moves some items of the old array into the new one. Items are moved a
+     *  whole run at a time, so that the slots that remain in the old array
+     *  can still be searched.
+     * @param slotQty  The number of old slots to move, at least.
+     * @pre None.
+     * @post At least slotQty more slots of oldSlots, or all that were left,
+     *       have been moved. If none are left, oldSlots is released and no
+     *       rehash is under way.
+     */
+    void moveItems(size_t slotQty);
+
+    /** Finds the number of slots needed for a number of items.
+     * @param itemQty  The number of items.
+     * @pre None.
+     * @post None.
+     * @return The smallest power of two, at least MINHASHCAPACITY, that is
+     *         at least twice itemQty.
+     */
+    static size_t capacityFor(size_t itemQty);
+
+}; // end HashIndex
+
+
+#include "HashIndex.cpp"
+
+#endif	/* _HASHINDEX_H */
@@ -84,12 +84,12 @@ bool History::isBorrowed(const Merch *target) const
         tempMerch = tempNode->record->getItem();
 
         // item found - determine if last Transaction was a Borrow and return
-        if (tempMerch->getSearchKey() == target->getSearchKey())
+        if (tempMerch->getItemKey() == target->getItemKey())
         {
             delete tempMerch;
             tempMerch = NULL;
             return tempNode->record->getMediaCode() == 'B';
-        } // end if (tempMerch->getSearchKey() == target->getSearchKey())
+        } // end if (tempMerch->getItemKey() == target->getItemKey())
 
         tempNode = tempNode->next;  // set to search next node
         delete tempMerch;           // delete copy of Merchandise
@@ -1,140 +1,542 @@
 /*
  * @file    Inventory.cpp
  * @brief   This class represents the merchandise inventory of a rental shop.
- *          Each unique piece of merchandise is stored in a chained hash table,
- *          along with the quantity that the shop owns and the quantity that is
- *          currently available for rent. A limit may be set on the amount of
- *          merchandise expected in the inventory, as well as the quantity of
- *          each type of merchandise allowed.
+ *          Each unique piece of merchandise is stored, along with the quantity
+ *          that the shop owns and the quantity that is currently available for
+ *          rent, in a balanced search tree that holds its genre in sorted
+ *          order for listing, and in a hash index on its whole search key for
+ *          finding it again. Secondary indexes find merchandise by director,
+ *          major actor or year, and an inverted index by the words of its
+ *          title. A limit may be set on the amount of merchandise expected in
+ *          the inventory, as well as the quantity of each type of merchandise
+ *          allowed.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <new>
 #include "Inventory.h"
 
 
 Inventory::Inventory(int idealQty = 47, int qtyCap = 10) :
-             itemQty(idealQty), maxQty(qtyCap)
+             itemQty(idealQty), maxQty(qtyCap), lookupMisses(0),
+             stockIndex(idealQty)
 {
-    allItems[itemQty];
 } // end Constructor
 
 Inventory::~Inventory()
 {
-    delete[] allItems;
+    for (int i = 0; i < INVENTORYSIZE; ++i)
+    {
+        allItems[i].inorderTraverse(destroyItem);
+    } // end for (i < INVENTORYSIZE)
 } // end Destructor
 
 bool Inventory::isEmpty(void) const
 {
-    for (int i = 0; i < itemQty; ++i)
-    {
-        if (!allItems[i].isEmpty())
-        {
-            return false;
-        } // end if (!allItems[i].isEmpty())
-    } // end for (i < itemQty)
-
-    return true;
+    return stockIndex.isEmpty();    // every item is in the index
 } // end isEmpty()
 
 bool Inventory::addItem(const Merch *item)
 {
-    KeyedItem keyedMerch(item);
+    Merch *itemCopy = NULL;
+    AttributeSet attributes;
     bool success = item != NULL;
 
     if (success)
     {
         try
         {
-            allItems[hashIndex(item)].searchTreeInsert(keyedMerch);
-            success = true;     // the item was inserted successfully
+            itemCopy = item->copy();
+            success = stockIndex.insert(itemCopy->getItemKey(), itemCopy);
         }
         catch (TreeException e)
         {
+            success = false;    // index could not grow
+        } // end try
+
+        if (success)
+        {
+            readAttributes(itemCopy, attributes);
+            success = addAttributes(attributes, AttributeSet(),
+                                    itemCopy->getItemKey(), itemCopy);
+
+            if (!success)
+            {
+                stockIndex.remove(itemCopy->getItemKey());
+            } // end if (!success)
+        } // end if (success)
+
+        if (success)
+        {
+            success = titleIndex.addTitle(readTitle(itemCopy),
+                                          itemCopy->getItemKey(), "");
+
+            if (!success)
+            {
+                dropAttributes(attributes, AttributeSet(),
+                               itemCopy->getItemKey(), NULL);
+                stockIndex.remove(itemCopy->getItemKey());
+            } // end if (!success)
+        } // end if (success)
+
+        if (success)
+        {
+            try
+            {
+                allItems[partitionIndex(item)].searchTreeInsert(
+                                            itemCopy->getItemKey(), itemCopy);
+            }
+            catch (TreeException e)
+            {
+                titleIndex.removeTitle(readTitle(itemCopy),
+                                       itemCopy->getItemKey(), "");
+                dropAttributes(attributes, AttributeSet(),
+                               itemCopy->getItemKey(), NULL);
+                stockIndex.remove(itemCopy->getItemKey());
+                success = false;    // item could not be inserted
+            } // end try
+        } // end if (success)
+
+        if (!success)       // already stocked, or out of memory
+        {
+            delete itemCopy;
             cout << "ERROR: Could not add ";
             item->display();
             cout << " to inventory." << endl;
-            success = false;    // item could not be inserted
-        } // end try
+        } // end if (!success)
     } // end if (success)
 
     return success;
 } // end addItem(Merch*)
 
+bool Inventory::addItems(const vector<const Merch*>& items)
+{
+    vector<Merch*> copies;
+    bool success = true;
+
+    copies.reserve(items.size());
+
+    for (size_t i = 0; i < items.size(); ++i)       // copy each item
+    {
+        if (items[i] != NULL)
+        {
+            copies.push_back(items[i]->copy());
+        }
+        else
+        {
+            success = false;    // nothing to add
+        } // end if (items[i] != NULL)
+    } // end for (i < items.size())
+
+    // the copies belong to nothing else, so they can be handed over
+    return addItems(move(copies)) && success;
+} // end addItems(vector<const Merch*>&)
+
+bool Inventory::addItems(vector<Merch*>&& items)
+{
+    vector<StockEntry> newItems[INVENTORYSIZE];     // new items, by genre
+    vector<StockEntry> merged;                      // one rebuilt partition
+    vector<pair<string, ItemKey> > titles;          // titles of new items
+    AttributeSet attributes;
+    bool success = true;
+    bool indexed = false;
+
+    try
+    {
+        stockIndex.reserve(stockIndex.getLength() +
+                           static_cast<int>(items.size()));
+    }
+    catch (TreeException e)
+    {
+        // the index grows as it is filled instead
+    } // end try
+
+    for (size_t i = 0; i < items.size(); ++i)       // index and distribute
+    {
+        indexed = false;
+
+        if (items[i] != NULL)
+        {
+            try
+            {
+                indexed = stockIndex.insert(items[i]->getItemKey(), items[i]);
+            }
+            catch (TreeException e)
+            {
+                indexed = false;    // index could not grow
+            } // end try
+        } // end if (items[i] != NULL)
+
+        if (indexed)
+        {
+            readAttributes(items[i], attributes);
+            indexed = addAttributes(attributes, AttributeSet(),
+                                    items[i]->getItemKey(), items[i]);
+
+            if (!indexed)
+            {
+                stockIndex.remove(items[i]->getItemKey());
+            } // end if (!indexed)
+        } // end if (indexed)
+
+        if (indexed)
+        {
+            newItems[partitionIndex(items[i])].push_back(
+                            StockEntry(items[i]->getItemKey(), items[i]));
+        }
+        else
+        {
+            delete items[i];    // NULL, already stocked, or out of memory
+            success = false;
+        } // end if (indexed)
+    } // end for (i < items.size())
+
+    items.clear();              // every item now belongs to a partition
+
+    for (int i = 0; i < INVENTORYSIZE; ++i)         // gather the titles
+    {
+        for (size_t j = 0; j < newItems[i].size(); ++j)
+        {
+            titles.push_back(pair<string, ItemKey>(
+                    readTitle(newItems[i][j].second), newItems[i][j].first));
+        } // end for (j < newItems[i].size())
+    } // end for (i < INVENTORYSIZE)
+
+    // entered in one batch, so each title word is looked up only once
+    if (!titles.empty() && !titleIndex.addTitles(titles))
+    {
+        for (int i = 0; i < INVENTORYSIZE; ++i)
+        {
+            for (size_t j = 0; j < newItems[i].size(); ++j)
+            {
+                readAttributes(newItems[i][j].second, attributes);
+                dropAttributes(attributes, AttributeSet(),
+                               newItems[i][j].first, NULL);
+                stockIndex.remove(newItems[i][j].first);
+                delete newItems[i][j].second;
+            } // end for (j < newItems[i].size())
+
+            newItems[i].clear();
+        } // end for (i < INVENTORYSIZE)
+
+        cout << "ERROR: Could not add " << titles.size()
+             << " items to inventory." << endl;
+        success = false;        // every partition is unchanged
+    } // end if (!titles.empty() && ...)
+
+    for (int i = 0; i < INVENTORYSIZE; ++i)         // rebuild each partition
+    {
+        if (newItems[i].empty())
+        {
+            continue;           // partition is unchanged
+        } // end if (newItems[i].empty())
+
+        stable_sort(newItems[i].begin(), newItems[i].end(), entryLess);
+        merged.clear();
+
+        if (!allItems[i].isEmpty())
+        {
+            AVLThreadedBST<ItemKey, Merch*>::Inorder index(allItems[i].begin());
+
+            for (;;)            // collect what the partition already holds
+            {
+                merged.push_back(StockEntry(index.getKey(), *index));
+
+                if (index == allItems[i].end())
+                {
+                    break;      // last item collected
+                } // end if (index == allItems[i].end())
+
+                ++index;
+            } // end for (;;)
+        } // end if (!allItems[i].isEmpty())
+
+        // the index has turned away keys already stocked, so none are equal
+        merged.insert(merged.end(), newItems[i].begin(), newItems[i].end());
+        inplace_merge(merged.begin(), merged.end() - newItems[i].size(),
+                      merged.end(), entryLess);
+
+        try
+        {
+            allItems[i].searchTreeBuild(merged.begin(), merged.end());
+        }
+        catch (TreeException e)
+        {
+            for (size_t j = 0; j < newItems[i].size(); ++j)
+            {
+                titleIndex.removeTitle(readTitle(newItems[i][j].second),
+                                       newItems[i][j].first, "");
+                readAttributes(newItems[i][j].second, attributes);
+                dropAttributes(attributes, AttributeSet(),
+                               newItems[i][j].first, NULL);
+                stockIndex.remove(newItems[i][j].first);
+                delete newItems[i][j].second;
+            } // end for (j < newItems[i].size())
+
+            cout << "ERROR: Could not add " << newItems[i].size()
+                 << " items to inventory." << endl;
+            success = false;    // partition is unchanged
+        } // end try
+    } // end for (i < INVENTORYSIZE)
+
+    return success;
+} // end addItems(vector<Merch*>&&)
+
 bool Inventory::updateItem(const Merch *item)
 {
-    KeyedItem keyedMerch(item);
+    Merch *stockItem = NULL;
+    AttributeSet oldSet, newSet;
+    ValueType oldTitle, newTitle;
     bool success = item != NULL;
 
+    if (success)
+    {
+        // the search key is unchanged, so the item is updated where it is
+        success = stockIndex.tryRetrieve(item->getItemKey(), stockItem);
+    } // end if (success)
+
+    if (success)
+    {
+        // new field values are entered first, so a failure changes nothing
+        readAttributes(stockItem, oldSet);
+        readAttributes(item, newSet);
+        success = addAttributes(newSet, oldSet, item->getItemKey(),
+                                stockItem);
+    } // end if (success)
+
+    if (success)
+    {
+        oldTitle = readTitle(stockItem);
+        newTitle = readTitle(item);
+        success = titleIndex.addTitle(newTitle, item->getItemKey(),
+                                      oldTitle);
+
+        if (!success)
+        {
+            dropAttributes(newSet, oldSet, item->getItemKey(), stockItem);
+        } // end if (!success)
+    } // end if (success)
+
     if (success)
     {
         try
         {
-            allItems[hashIndex(item)].searchTreeDelete(keyedMerch.getKey());
-            allItems[hashIndex(item)].searchTreeInsert(keyedMerch);
-            success = true;     // the item was updated successfully
+            stockItem->assign(*item);   // typed fields are copied, too
         }
         catch (TreeException e)
         {
-            cout << "ERROR: Could not update ";
-            item->display();
-            cout << " in inventory." << endl;
-            success = false;    // item could not be updated
+            titleIndex.removeTitle(newTitle, item->getItemKey(), oldTitle);
+            dropAttributes(newSet, oldSet, item->getItemKey(), stockItem);
+            success = false;    // fields could not be copied
         } // end try
     } // end if (success)
 
+    if (success)
+    {
+        titleIndex.removeTitle(oldTitle, item->getItemKey(), newTitle);
+        dropAttributes(oldSet, newSet, item->getItemKey(), stockItem);
+    } // end if (success)
+
+    if (!success && item != NULL)
+    {
+        cout << "ERROR: Could not update ";
+        item->display();
+        cout << " in inventory." << endl;
+    } // end if (!success && item != NULL)
+
     return success;
 } // end updateItem(Merch*)
 
+bool Inventory::replaceItem(Merch *item)
+{
+    Merch **stockItem = NULL;
+    AttributeSet oldSet, newSet;
+    ValueType oldTitle, newTitle;
+    bool success = false;
+
+    if (item == NULL)
+    {
+        return false;
+    } // end if (item == NULL)
+
+    // the search key is unchanged, so the item is swapped in where it is
+    stockItem = allItems[partitionIndex(item)].findMutable(
+                                                        item->getItemKey());
+
+    if (stockItem != NULL)
+    {
+        readAttributes(*stockItem, oldSet);
+        readAttributes(item, newSet);
+        success = addAttributes(newSet, oldSet, item->getItemKey(), item);
+    } // end if (stockItem != NULL)
+
+    if (success)
+    {
+        oldTitle = readTitle(*stockItem);
+        newTitle = readTitle(item);
+        success = titleIndex.addTitle(newTitle, item->getItemKey(),
+                                      oldTitle);
+
+        if (!success)
+        {
+            dropAttributes(newSet, oldSet, item->getItemKey(), *stockItem);
+        } // end if (!success)
+    } // end if (success)
+
+    if (!success)
+    {
+        cout << "ERROR: Could not update ";
+        item->display();
+        cout << " in inventory." << endl;
+        delete item;            // item belongs to this Inventory either way
+        return false;
+    } // end if (!success)
+
+    stockIndex.update(item->getItemKey(), item);
+    titleIndex.removeTitle(oldTitle, item->getItemKey(), newTitle);
+    dropAttributes(oldSet, newSet, item->getItemKey(), item);
+    swap(*stockItem, item);
+    delete item;                // the item that was replaced
+
+    return true;
+} // end replaceItem(Merch*)
+
 bool Inventory::removeItem(const Merch *item)
 {
-    KeyedItem keyedMerch(item);
+    Merch *oldItem = NULL;
+    AttributeSet oldSet;
     bool success = item != NULL;
 
-    if (success)
+    if (success && stockIndex.tryRetrieve(item->getItemKey(), oldItem))
     {
         try
         {
-            allItems[hashIndex(item)].searchTreeDelete(keyedMerch.getKey());
+            allItems[partitionIndex(item)].searchTreeDelete(
+                                                        item->getItemKey());
+            readAttributes(oldItem, oldSet);
+            dropAttributes(oldSet, AttributeSet(), item->getItemKey(), NULL);
+            titleIndex.removeTitle(readTitle(oldItem), item->getItemKey(), "");
+            stockIndex.remove(item->getItemKey());
+            delete oldItem;
             success = true;     // the item was deleted successfully
         }
         catch (TreeException e)
         {
-            cout << "ERROR: Could not delete ";
-            item->display();
-            cout << " from inventory." << endl;
             success = false;    // item could not be deleted
         } // end try
-    } // end if (success)
+    }
+    else
+    {
+        success = false;        // item is not stocked
+    } // end if (success && ...)
+
+    if (!success && item != NULL)
+    {
+        cout << "ERROR: Could not delete ";
+        item->display();
+        cout << " from inventory." << endl;
+    } // end if (!success && item != NULL)
 
     return success;
 } // end removeItem(Merch*)
 
 Merch* Inventory::retrieveItem(const Merch *item) const
 {
-    KeyedItem keyedMerch(item);
+    Merch *stockItem = NULL;
 
-    if (item != NULL)
+    if (item != NULL &&
+        !stockIndex.tryRetrieve(item->getItemKey(), stockItem))
     {
-        try
-        {
-            // get a copy of the full record
-            allItems[hashIndex(item)].searchTreeRetrive(keyedMerch.getKey(),
-                                                        keyedMerch);
-        }
-        catch (TreeException e)
-        {
-            cout << "ERROR: could not retrieve ";
-            item->display();
-            cout << " from inventory." << endl;
-            return NULL;
-        } // end try
-    } // end if (item != NULL)
+        // counted rather than reported; misses are common
+        lookupMisses.fetch_add(1, memory_order_relaxed);
+        return NULL;
+    } // end if (item != NULL && ...)
 
-    return keyedMerch.getItem();
+    // return a copy of the full record
+    return (stockItem == NULL ? NULL : stockItem->copy());
 } // end retrieveItem(Merch*)
 
+bool Inventory::borrowItem(const Merch *item)
+{
+    Merch *stockItem = NULL;
+
+    if (item == NULL ||
+        !stockIndex.tryRetrieve(item->getItemKey(), stockItem))
+    {
+        return false;       // item is not stocked
+    } // end if (item == NULL || ...)
+
+    return stockItem->checkOut();
+} // end borrowItem(Merch*)
+
+bool Inventory::returnItem(const Merch *item)
+{
+    Merch *stockItem = NULL;
+
+    if (item == NULL ||
+        !stockIndex.tryRetrieve(item->getItemKey(), stockItem))
+    {
+        return false;       // item is not stocked
+    } // end if (item == NULL || ...)
+
+    return stockItem->checkIn();
+} // end returnItem(Merch*)
+
+int Inventory::findByDirector(const string& director,
+                              vector<const Merch*>& items) const
+{
+    ItemKey value(TextRef(director), 0, TextRef());
+
+    return findInRange(DIRECTORFIELD, value, value, items);
+} // end findByDirector(string&, vector<Merch*>&)
+
+int Inventory::findByActor(const string& actor,
+                           vector<const Merch*>& items) const
+{
+    ItemKey value(TextRef(actor), 0, TextRef());
+
+    return findInRange(MAJORACTORFIELD, value, value, items);
+} // end findByActor(string&, vector<Merch*>&)
+
+int Inventory::findByYear(int firstYear, int lastYear,
+                          vector<const Merch*>& items) const
+{
+    if (lastYear < 1 || lastYear < firstYear)
+    {
+        return 0;       // no year is in the range
+    } // end if (lastYear < 1 || lastYear < firstYear)
+
+    return findInRange(YEARFIELD,
+                       ItemKey(TextRef(), (firstYear < 1 ? 1 : firstYear),
+                               TextRef()),
+                       ItemKey(TextRef(), lastYear, TextRef()), items);
+} // end findByYear(int, int, vector<Merch*>&)
+
+int Inventory::findByTitle(const string& words,
+                           vector<const Merch*>& items) const
+{
+    vector<ItemKey> movies;
+    Merch *stockItem = NULL;
+    int count = 0;
+
+    titleIndex.findTitles(words, movies);
+
+    for (size_t i = 0; i < movies.size(); ++i)
+    {
+        if (stockIndex.tryRetrieve(movies[i], stockItem))
+        {
+            items.push_back(stockItem);
+            ++count;
+        } // end if (stockIndex.tryRetrieve(movies[i], stockItem))
+    } // end for (i < movies.size())
+
+    return count;
+} // end findByTitle(string&, vector<Merch*>&)
+
 int Inventory::getItemQty(void) const
 {
     return itemQty;
@@ -142,11 +544,20 @@ int Inventory::getItemQty(void) const
 
 bool Inventory::setItemQty(int newQty)
 {
-    bool success = newQty > 0;
+    bool success = newQty > 0 && newQty >= stockIndex.getLength();
 
     if (success)
     {
-        itemQty = newQty;
+        try
+        {
+            // items move to the larger index as later changes are made
+            stockIndex.reserve(newQty);
+            itemQty = newQty;
+        }
+        catch (TreeException e)
+        {
+            success = false;    // index keeps its size
+        } // end try
     } // end if (success)
 
     return success;
@@ -171,36 +582,249 @@ bool Inventory::setMaxQty(int newQty)
 
 void Inventory::displayInventory(void) const
 {
-    for (int i = 0; i < itemQty; ++i)           // step through hash table
+    for (int i = 0; i < INVENTORYSIZE; ++i)     // step through genres
     {
-        ThreadedBST::Inorder index(allItems[i].begin());
+        if (allItems[i].isEmpty())
+        {
+            continue;   // no merchandise of this genre
+        } // end if (allItems[i].isEmpty())
 
-        while(index != allItems[i].end())       // step through container
+        AVLThreadedBST<ItemKey, Merch*>::Inorder index(allItems[i].begin());
+        AVLThreadedBST<ItemKey, Merch*>::Inorder last(allItems[i].end());
+
+        for (;;)        // step through container, last item included
         {
-            (*index).getItem()->displayLine();  // display contents of item
+            (*index)->displayLine();            // display contents of item
+
+            if (index == last)
+            {
+                break;
+            } // end if (index == last)
+
             ++index;
-        } // end while(index != allItems[i].end())
-    } // end for (i < itemQty)
+        } // end for (;;)
+    } // end for (i < INVENTORYSIZE)
 } // end showInventory()
 
-int Inventory::hashIndex(const Merch *item) const
+int Inventory::getOnHandTotal(void) const
+{
+    int total = 0;
+
+    for (int i = 0; i < INVENTORYSIZE; ++i)     // step through genres
+    {
+        total += allItems[i].inorderTraverse(OnHandTotal()).total;
+    } // end for (i < INVENTORYSIZE)
+
+    return total;
+} // end getOnHandTotal()
+
+int Inventory::getLookupMisses(void) const
+{
+    return lookupMisses.load(memory_order_relaxed);
+} // end getLookupMisses()
+
+void Inventory::buildCatalog(Catalog& catalog) const
+{
+    catalog.clear();
+
+    for (int i = 0; i < INVENTORYSIZE; ++i)     // step through genres
+    {
+        if (allItems[i].isEmpty())
+        {
+            continue;   // nothing to catalog in this partition
+        } // end if (allItems[i].isEmpty())
+
+        AVLThreadedBST<ItemKey, Merch*>::Inorder index(allItems[i].begin());
+        AVLThreadedBST<ItemKey, Merch*>::Inorder last(allItems[i].end());
+
+        for (;;)        // step through container, last item included
+        {
+            catalog.addMovie(*index);
+
+            if (index == last)
+            {
+                break;
+            } // end if (index == last)
+
+            ++index;
+        } // end for (;;)
+    } // end for (i < INVENTORYSIZE)
+} // end buildCatalog(Catalog&)
+
+int Inventory::partitionIndex(const Merch *item) const
 {
-    KeyedItem tempKey("Item Code");
+    ValueType itemCode;
 
     if (item != NULL)
     {
         try
         {
-            if (item->getField(tempKey))
+            if (item->getField(ITEMCODEFIELD, itemCode) &&
+                !itemCode.empty() && itemCode[0] >= 'A' && itemCode[0] <= 'Z')
             {
-                return (tempKey.getValue().at(0) - 'A') % itemQty;
-            } // end if (item->getField(tempKey))
+                return itemCode[0] - 'A';
+            } // end if (item->getField(ITEMCODEFIELD, itemCode) && ...)
         }
         catch (TreeException e)
         {
-            cout << "ERROR: Could not hash value in Inventory." << endl;
+            cout << "ERROR: Could not find genre in Inventory." << endl;
         } // end try
     } // end if (item != NULL)
 
     return 0;   // default if given NULL pointer or item code not found
-} // end hashIndex(Merch*)
+} // end partitionIndex(Merch*)
+
+void Inventory::readAttributes(const Merch *item, AttributeSet& attributes)
+{
+    ValueType fieldValue;
+    int number;
+
+    for (int i = 0; i < INDEXEDFIELDQTY; ++i)
+    {
+        attributes.present[i] = false;
+
+        if (!item->getField(INDEXEDFIELDS[i], fieldValue))
+        {
+            continue;   // not a field of this kind of merchandise
+        } // end if (!item->getField(INDEXEDFIELDS[i], fieldValue))
+
+        if (INDEXEDFIELDS[i] == YEARFIELD)
+        {
+            number = atoi(fieldValue.c_str());
+            attributes.values[i] = ItemKey(TextRef(), number, TextRef());
+            attributes.present[i] = number > 0;
+        }
+        else
+        {
+            try
+            {
+                // stocked text is already in the arena, so this is a lookup
+                attributes.values[i] = ItemKey(
+                        StringArena::shared().intern(fieldValue), 0, TextRef());
+                attributes.present[i] = !fieldValue.empty();
+            }
+            catch (bad_alloc e)
+            {
+                attributes.present[i] = false;  // left out of the index
+            } // end try
+        } // end if (INDEXEDFIELDS[i] == YEARFIELD)
+    } // end for (i < INDEXEDFIELDQTY)
+} // end readAttributes(Merch*, AttributeSet&)
+
+ValueType Inventory::readTitle(const Merch *item)
+{
+    ValueType title;
+
+    // merchandise without a title is simply left out of the title index
+    item->getField(TITLEFIELD, title);
+    return title;
+} // end readTitle(Merch*)
+
+bool Inventory::addAttributes(const AttributeSet& newSet,
+                              const AttributeSet& oldSet,
+                              const ItemKey& searchKey, Merch *item)
+{
+    int i;
+
+    for (i = 0; i < INDEXEDFIELDQTY; ++i)
+    {
+        if (newSet.adds(i, oldSet))
+        {
+            try
+            {
+                byField[i].searchTreeInsert(
+                            AttributeKey(newSet.values[i], searchKey), item);
+            }
+            catch (TreeException e)
+            {
+                break;  // take back what was entered
+            } // end try
+        } // end if (newSet.adds(i, oldSet))
+    } // end for (i < INDEXEDFIELDQTY)
+
+    if (i == INDEXEDFIELDQTY)
+    {
+        return true;
+    } // end if (i == INDEXEDFIELDQTY)
+
+    while (--i >= 0)
+    {
+        if (newSet.adds(i, oldSet))
+        {
+            byField[i].searchTreeDelete(
+                            AttributeKey(newSet.values[i], searchKey));
+        } // end if (newSet.adds(i, oldSet))
+    } // end while (--i >= 0)
+
+    return false;
+} // end addAttributes(AttributeSet&, AttributeSet&, ItemKey&, Merch*)
+
+void Inventory::dropAttributes(const AttributeSet& oldSet,
+                               const AttributeSet& newSet,
+                               const ItemKey& searchKey, Merch *item)
+{
+    Merch **entry = NULL;
+
+    for (int i = 0; i < INDEXEDFIELDQTY; ++i)
+    {
+        if (oldSet.adds(i, newSet))
+        {
+            try
+            {
+                byField[i].searchTreeDelete(
+                                AttributeKey(oldSet.values[i], searchKey));
+            }
+            catch (TreeException e)
+            {
+                // not entered; nothing to remove
+            } // end try
+        }
+        else if (oldSet.present[i])     // entry is kept, but may move
+        {
+            entry = byField[i].findMutable(
+                                AttributeKey(oldSet.values[i], searchKey));
+
+            if (entry != NULL)
+            {
+                *entry = item;
+            } // end if (entry != NULL)
+        } // end if (oldSet.adds(i, newSet))
+    } // end for (i < INDEXEDFIELDQTY)
+} // end dropAttributes(AttributeSet&, AttributeSet&, ItemKey&, Merch*)
+
+int Inventory::findInRange(FieldID field, const ItemKey& first,
+                           const ItemKey& last,
+                           vector<const Merch*>& items) const
+{
+    int count = 0;
+
+    for (int i = 0; i < INDEXEDFIELDQTY; ++i)
+    {
+        if (INDEXEDFIELDS[i] != field)
+        {
+            continue;
+        } // end if (INDEXEDFIELDS[i] != field)
+
+        AttributeTree::Inorder entry(byField[i].lowerBound(first));
+        AttributeTree::Inorder stop(byField[i].upperBound(last));
+
+        for (; entry != stop; ++entry)  // O(log n) to start, then O(1) each
+        {
+            items.push_back(*entry);
+            ++count;
+        } // end for (; entry != stop; ++entry)
+    } // end for (i < INDEXEDFIELDQTY)
+
+    return count;
+} // end findInRange(FieldID, ItemKey&, ItemKey&, vector<Merch*>&)
+
+bool Inventory::entryLess(const StockEntry& lhs, const StockEntry& rhs)
+{
+    return lhs.first < rhs.first;
+} // end entryLess(StockEntry&, StockEntry&)
+
+void Inventory::destroyItem(const ItemKey&, Merch*& item)
+{
+    delete item;
+    item = NULL;
+} // end destroyItem(ItemKey&, Merch*&)
@@ -1,9 +1,13 @@
 /*
  * @file    Inventory.h
  * @brief   This class represents the merchandise inventory of a rental shop.
- *          Each unique piece of merchandise is stored in a chained hash table,
- *          along with the quantity that the shop owns and the quantity that is
- *          currently available for rent. A limit may be set on the amount of
+ *          Each unique piece of merchandise is stored, along with the quantity
+ *          that the shop owns and the quantity that is currently available for
+ *          rent, in a balanced search tree that holds its genre in sorted
+ *          order for listing, and in a hash index on its whole search key for
+ *          finding it again. Secondary indexes find merchandise by director,
+ *          major actor or year, and an inverted index by the words of its
+ *          title. A limit may be set on the amount of
  *          merchandise expected in the inventory, as well as the quantity of
  *          each type of merchandise allowed.
  * @author  Brendan Sweeney, SID 1161836
@@ -13,9 +17,22 @@
 #ifndef _INVENTORY_H
 #define	_INVENTORY_H
 
+#include <atomic>
+#include <utility>
+#include <vector>
+#include "AVLThreadedBST.h"
+#include "Catalog.h"
+#include "HashIndex.h"
 #include "Merch.h"
+#include "TitleIndex.h"
 
-const int INVENTORYSIZE = 'F' - 'A';
+// one partition for each genre, found by the initial of its item code
+const int INVENTORYSIZE = 'Z' - 'A' + 1;
+
+// fields with a secondary index, in the order of Inventory::byField
+const int INDEXEDFIELDQTY = 3;
+const FieldID INDEXEDFIELDS[INDEXEDFIELDQTY] = { DIRECTORFIELD, MAJORACTORFIELD,
+                                                 YEARFIELD };
 
 
 class Inventory
@@ -26,7 +43,8 @@ public:
  * Creates a Merchandise Inventory of a specified target size and with a limit
  * on the quantity of each item that will be held.
  * @param idealQty  A positive value indicating how many unique types of
- *                  merchandise this Inventory can hold. Should be prime.
+ *                  merchandise this Inventory can hold. The hash index is
+ *                  sized to hold this many without growing.
  * @param qtyCap  A positive value indicating how many of each type of
  *                Merchandise this Inventory can hold.
  * @pre merchCap and qtyCap are greater than zero.
@@ -57,23 +75,67 @@ public:
  * updateItem() instead.
  * @param item  The merchandise to add.
  * @pre There is sufficient room in this Inventory for the merchandise.
- * @post The specified merchandise is copied into this Inventory, indexed by a
- *       hash of its descriptive name.
- * @return true if there was sufficient space in this Inventory for the
- *         merchandise; false, otherwise.
+ * @post The specified merchandise is copied into the partition for its genre
+ *       and indexed by a hash of its search key.
+ * @return true if the merchandise was added; false if there was not
+ *         sufficient space in this Inventory or it was already there.
  */
     bool addItem(const Merch *item);
 
+/**---------------------- addItems() ------------------------------------------
+ * Adds a batch of merchandise to this Inventory at once. The batch is sorted
+ * by search key within each genre partition, merged with what the partition
+ * already holds, and the partition is rebuilt as a balanced tree in a single
+ * pass. The result is the same as adding each item with addItem(), but each
+ * partition is built in linear time after the sort.
+ * @param items  The merchandise to add; NULL entries, and merchandise already
+ *               in this Inventory or earlier in the batch, are skipped.
+ * @pre There is sufficient room in this Inventory for the merchandise.
+ * @post Each piece of merchandise is copied into the partition for its genre
+ *       and indexed by a hash of its search key.
+ * @return true if every piece of merchandise was added; false, otherwise.
+ */
+    bool addItems(const vector<const Merch*>& items);
+
+/**---------------------- addItems() (Move) -----------------------------------
+ * Adds a batch of merchandise to this Inventory at once, taking ownership of
+ * each piece instead of copying it. Otherwise the same as the form above.
+ * @param items  The merchandise to add; each was allocated with new and is
+ *               owned by nothing else. NULL entries are skipped.
+ * @pre There is sufficient room in this Inventory for the merchandise.
+ * @post Each piece of merchandise is held by this Inventory, in the partition
+ *       for its genre and indexed by a hash of its search key, or deleted if
+ *       it could not be added.
+ *       items is empty.
+ * @return true if every piece of merchandise was added; false, otherwise.
+ */
+    bool addItems(vector<Merch*>&& items);
+
 /**---------------------- updateItem() ----------------------------------------
  * Updates the values of a piece of Merchandise. The provided Merchandise will
  * replace the original. If the Merchandise cannot be found, it will not be
  * added. To add new Merchandise, use addItem() instead.
+ * The stored Merchandise is overwritten where it is, so its search key must
+ * not change; to change a search key, remove the item and add it again.
  * @pre The specified Merchandise exists in this Inventory.
  * @post The specified merchandise replaces the one that was in this Inventory.
  * @return true if the Merchandise was found and replaced; false, otherwise.
  */
     bool updateItem(const Merch *item);
 
+/**---------------------- replaceItem() ---------------------------------------
+ * Updates the values of a piece of Merchandise, taking ownership of the
+ * provided Merchandise instead of copying it. Otherwise the same as
+ * updateItem().
+ * @param item  The replacement Merchandise, allocated with new and owned by
+ *              nothing else.
+ * @pre The specified Merchandise exists in this Inventory.
+ * @post The specified merchandise replaces the one that was in this Inventory,
+ *       or is deleted if it could not. The caller must not use item again.
+ * @return true if the Merchandise was found and replaced; false, otherwise.
+ */
+    bool replaceItem(Merch *item);
+
 /**---------------------- removeItem() ----------------------------------------
  * Removes a piece of merchandise from this Inventory.
  * @param item  The merchandise to remove.
@@ -87,12 +149,95 @@ public:
  * Retrieves a piece of merchandise from this Inventory. The item is copied and
  * a pointer returned.
  * @param item  The merchandise to retrieve.
- * @pre The specified merchandise exists in this Inventory.
- * @post A new copy of the specified Merchandise exists.
- * @return A pointer to a new copy of the specified Merchandise.
+ * @pre None.
+ * @post A new copy of the specified Merchandise exists, if it was found. A
+ *       miss is counted rather than reported.
+ * @return A pointer to a new copy of the specified Merchandise, or NULL if it
+ *         is not in this Inventory.
  */
     Merch* retrieveItem(const Merch *item) const;
 
+/**---------------------- borrowItem() ----------------------------------------
+ * Takes one copy of a piece of merchandise off hand. The stocked item's
+ * counter is decreased where it is, so nothing is copied or written back, and
+ * several threads may borrow at once while no other change is made to this
+ * Inventory.
+ * @param item  The merchandise to borrow; only its search key is read.
+ * @pre None.
+ * @post The stocked item has one less copy on hand, if this returned true;
+ *       otherwise this Inventory is unchanged.
+ * @return true if a copy was taken; false if item is not stocked or only one
+ *         copy of it is on hand.
+ */
+    bool borrowItem(const Merch *item);
+
+/**---------------------- returnItem() ----------------------------------------
+ * Puts one copy of a piece of merchandise back on hand. Like borrowItem(),
+ * this changes only the stocked item's counter.
+ * @param item  The merchandise to return; only its search key is read.
+ * @pre None.
+ * @post The stocked item has one more copy on hand, if this returned true;
+ *       otherwise this Inventory is unchanged.
+ * @return true if a copy was put back; false if item is not stocked or every
+ *         copy of it is already on hand.
+ */
+    bool returnItem(const Merch *item);
+
+/**---------------------- findByDirector() ------------------------------------
+ * Lists the merchandise made by a director.
+ * @param director  The name of the director, exactly as stocked.
+ * @param items  A container to which the merchandise is appended.
+ * @pre None.
+ * @post items ends with every piece of merchandise whose director is
+ *       director, in order of search key. Each stays valid until it is
+ *       removed from or replaced in this Inventory, and must not be deleted.
+ * @return The number of pieces of merchandise appended.
+ */
+    int findByDirector(const string& director,
+                       vector<const Merch*>& items) const;
+
+/**---------------------- findByActor() ---------------------------------------
+ * Lists the merchandise in which an actor has a major role.
+ * @param actor  The name of the actor, exactly as stocked.
+ * @param items  A container to which the merchandise is appended.
+ * @pre None.
+ * @post items ends with every piece of merchandise whose major actor is
+ *       actor, in order of search key. Each stays valid until it is removed
+ *       from or replaced in this Inventory, and must not be deleted.
+ * @return The number of pieces of merchandise appended.
+ */
+    int findByActor(const string& actor, vector<const Merch*>& items) const;
+
+/**---------------------- findByYear() ----------------------------------------
+ * Lists the merchandise released in a range of years.
+ * @param firstYear  The earliest year to include.
+ * @param lastYear  The latest year to include.
+ * @param items  A container to which the merchandise is appended.
+ * @pre None.
+ * @post items ends with every piece of merchandise whose year is from
+ *       firstYear to lastYear, in order of year and then of search key. Each
+ *       stays valid until it is removed from or replaced in this Inventory,
+ *       and must not be deleted.
+ * @return The number of pieces of merchandise appended.
+ */
+    int findByYear(int firstYear, int lastYear,
+                   vector<const Merch*>& items) const;
+
+/**---------------------- findByTitle() ---------------------------------------
+ * Lists the merchandise whose title contains every word of a search, whatever
+ * their case or order. If the search does not end with a space or
+ * punctuation, its last word matches any word that begins with it, so
+ * "wizard o" finds "The Wizard of Oz".
+ * @param words  The words to search for, as typed.
+ * @param items  A container to which the merchandise is appended.
+ * @pre None.
+ * @post items ends with every piece of merchandise whose title matches
+ *       words, in order of search key. Each stays valid until it is removed
+ *       from or replaced in this Inventory, and must not be deleted.
+ * @return The number of pieces of merchandise appended.
+ */
+    int findByTitle(const string& words, vector<const Merch*>& items) const;
+
 /**---------------------- getItemQty() ----------------------------------------
  * Retrieves the maximum number of unique merchandise this Inventory can hold.
  * @pre None.
@@ -102,11 +247,15 @@ public:
     int getItemQty(void) const;
 
 /**---------------------- setItemQty() ----------------------------------------
- * Sets the maximum number of unique merchdise this Inventory can hold.
+ * Sets the maximum number of unique merchdise this Inventory can hold. A
+ * larger hash index is made at once, but merchandise is moved into it a little
+ * at a time by later changes, so no one call pauses to move all of it.
  * @param newMax  The new maximum number of unique merchandise; must be
- *                positive, should be prime.
+ *                positive, and no less than the merchandise now held.
  * @pre None.
- * @post This Inventory can now hold newMax unique merchandise.
+ * @post This Inventory can now hold newMax unique merchandise, if it returned
+ *       true; otherwise it is unchanged.
+ * @return true if the size was changed; false, otherwise.
  */
     bool setItemQty(int newMax);
 
@@ -128,27 +277,239 @@ public:
     bool setMaxQty(int newQty);
 
 /**---------------------- displayInventory() ----------------------------------
- * Displays the complete contents of this Inventory.
+ * Displays the complete contents of this Inventory, one genre at a time.
  * @pre None.
  * @post The contents of this Inventory are displayed to cout.
  */
     void displayInventory(void) const;
 
+/**---------------------- getOnHandTotal() ------------------------------------
+ * Counts the copies of merchandise on hand across this whole Inventory.
+ * @pre None.
+ * @post None.
+ * @return The sum of the on-hand quantities of every piece of merchandise.
+ */
+    int getOnHandTotal(void) const;
+
+/**---------------------- getLookupMisses() -----------------------------------
+ * Retrieves the number of times retrieveItem() has not found the merchandise
+ * it was asked for.
+ * @pre None.
+ * @post None.
+ * @return The number of lookups that missed.
+ */
+    int getLookupMisses(void) const;
+
+/**---------------------- buildCatalog() --------------------------------------
+ * Copies every piece of merchandise in this Inventory into a Catalog, for
+ * scans that would otherwise visit every partition.
+ * @param catalog  The Catalog to fill.
+ * @pre None.
+ * @post catalog holds the merchandise of this Inventory, genre by genre and
+ *       in sorted order within each genre, and nothing else.
+ */
+    void buildCatalog(Catalog& catalog) const;
+
 private:
 
+    /** Adds up the on-hand quantities of the merchandise in a partition.
+     *  Passed to a partition traversal, which calls it inline for each item.
+     */
+    class OnHandTotal
+    {
+    public:
+
+        OnHandTotal() : total(0)
+        {
+        } // end constructor
+
+        void operator()(const ItemKey&, Merch * const& item)
+        {
+            total += item->getOnHandQty();
+        } // end operator()(ItemKey&, Merch*&)
+
+        int total;              // on-hand quantity of the items seen so far
+
+    }; // end OnHandTotal
+
+    /** A key of a secondary index: the value of the indexed field, then the
+     *  search key of the merchandise, so that no two keys are equal. Compared
+     *  with a bare ItemKey, only the field value is used, so a search for a
+     *  value finds every piece of merchandise that has it.
+     */
+    class AttributeKey
+    {
+    public:
+
+        AttributeKey()
+        {
+        } // end default constructor
+
+        AttributeKey(const ItemKey& aValue, const ItemKey& anItem) :
+            value(aValue), item(anItem)
+        {
+        } // end constructor
+
+        bool operator<(const AttributeKey& rhs) const
+        {
+            int result = value.compare(rhs.value);
+
+            return (result != 0 ? result < 0 : item < rhs.item);
+        } // end operator<(AttributeKey&)
+
+        bool operator<(const ItemKey& rhs) const
+        {
+            return value < rhs;
+        } // end operator<(ItemKey&)
+
+        friend bool operator<(const ItemKey& lhs, const AttributeKey& rhs)
+        {
+            return lhs < rhs.value;
+        } // end operator<(ItemKey&, AttributeKey&)
+
+        ItemKey value;          // value of the indexed field
+        ItemKey item;           // search key of the merchandise
+
+    }; // end AttributeKey
+
+    /** The values of the indexed fields of one piece of merchandise. A text
+     *  is kept as the major part of an ItemKey and a number as the packed
+     *  part, so that one kind of key serves every index.
+     */
+    class AttributeSet
+    {
+    public:
+
+        AttributeSet()
+        {
+            for (int i = 0; i < INDEXEDFIELDQTY; ++i)
+            {
+                present[i] = false;
+            } // end for (i < INDEXEDFIELDQTY)
+        } // end constructor
+
+        /** Determines whether this set has a value for a field that other
+         *  does not have.
+         */
+        bool adds(int field, const AttributeSet& other) const
+        {
+            return present[field] && !(other.present[field] &&
+                                       other.values[field] == values[field]);
+        } // end adds(int, AttributeSet&)
+
+        ItemKey values[INDEXEDFIELDQTY];    // value of each indexed field
+        bool    present[INDEXEDFIELDQTY];   // whether a field has a value
+
+    }; // end AttributeSet
+
+    typedef AVLThreadedBST<AttributeKey, Merch*> AttributeTree;
+
     int         itemQty;        // maximum number of unique items to hold
     int         maxQty;         // maximum number of each item to hold
-    ThreadedBST allItems[INVENTORYSIZE];    // hash table of unique items
+    mutable atomic<int> lookupMisses;   // retrievals that found nothing
+    AVLThreadedBST<ItemKey, Merch*> allItems[INVENTORYSIZE];  // by genre
+    HashIndex<ItemKey, Merch*>      stockIndex;     // every item, by key
+    AttributeTree byField[INDEXEDFIELDQTY];     // items, by indexed field
+    TitleIndex    titleIndex;                   // items, by title words
+
+    typedef pair<ItemKey, Merch*> StockEntry;   // partition item for builds
 
-/**---------------------- hashIndex() -----------------------------------------
- * Calculates the hash table index for some given merchandise.
- * @param item  The merchandise whose index is to be found.
- * @pre item contains a descriptive name that is unique for that type of
- *      merchandise.
+/**---------------------- partitionIndex() ------------------------------------
+ * Finds the partition that holds the genre of some given merchandise.
+ * @param item  The merchandise whose partition is to be found.
+ * @pre item has an item code that begins with a capital letter, and no two
+ *      genres have item codes with the same initial.
  * @post None.
- * @return The hash table index of the specified merchandise.
+ * @return The partition of the specified merchandise; 0 if it has no usable
+ *         item code.
+ */
+    int partitionIndex(const Merch *item) const;
+
+/**---------------------- readAttributes() ------------------------------------
+ * Reads the values of the indexed fields of some given merchandise.
+ * @param item  The merchandise whose fields are read.
+ * @param attributes  A container for the values.
+ * @pre None.
+ * @post attributes holds a value for each indexed field that item has.
+ */
+    static void readAttributes(const Merch *item, AttributeSet& attributes);
+
+/**---------------------- readTitle() -----------------------------------------
+ * Reads the title of some given merchandise.
+ * @param item  The merchandise whose title is read.
+ * @pre None.
+ * @post None.
+ * @return The title of item, or an empty string if it has none.
+ */
+    static ValueType readTitle(const Merch *item);
+
+/**---------------------- addAttributes() -------------------------------------
+ * Enters the indexed field values of a piece of merchandise in the secondary
+ * indexes, leaving out any that are already entered for it. Either every
+ * value is entered or none is.
+ * @param newSet  The values to enter.
+ * @param oldSet  The values already entered for the merchandise.
+ * @param searchKey  The search key of the merchandise.
+ * @param item  The merchandise the new entries lead to.
+ * @pre None.
+ * @post Each value of newSet that is not in oldSet is entered for item, if
+ *       this returned true; otherwise the indexes are unchanged.
+ * @return true if every value was entered; false, otherwise.
+ */
+    bool addAttributes(const AttributeSet& newSet, const AttributeSet& oldSet,
+                       const ItemKey& searchKey, Merch *item);
+
+/**---------------------- dropAttributes() ------------------------------------
+ * Removes the indexed field values of a piece of merchandise from the
+ * secondary indexes, keeping any that are still current. The entries that are
+ * kept are made to lead to item.
+ * @param oldSet  The values to remove.
+ * @param newSet  The values that are still current.
+ * @param searchKey  The search key of the merchandise.
+ * @param item  The merchandise the kept entries lead to.
+ * @pre The values of oldSet are entered for the merchandise.
+ * @post Each value of oldSet that is not in newSet is no longer entered, and
+ *       each that is leads to item.
+ */
+    void dropAttributes(const AttributeSet& oldSet, const AttributeSet& newSet,
+                        const ItemKey& searchKey, Merch *item);
+
+/**---------------------- findInRange() ---------------------------------------
+ * Lists the merchandise entered in a secondary index under a range of values.
+ * @param field  The indexed field whose index is searched.
+ * @param first  The lowest value to include.
+ * @param last  The highest value to include.
+ * @param items  A container to which the merchandise is appended.
+ * @pre None.
+ * @post items ends with the merchandise entered under each value from first
+ *       to last, in order of value and then of search key.
+ * @return The number of pieces of merchandise appended; 0 if field has no
+ *         index.
+ */
+    int findInRange(FieldID field, const ItemKey& first, const ItemKey& last,
+                    vector<const Merch*>& items) const;
+
+/**---------------------- entryLess() -----------------------------------------
+ * Orders two partition items by search key alone. Used to sort and merge the
+ * items of a bulk build so that items with equal keys keep their order.
+ * @param lhs  The left-hand partition item.
+ * @param rhs  The right-hand partition item.
+ * @pre None.
+ * @post None.
+ * @return true if the key of lhs sorts before the key of rhs; false,
+ *         otherwise.
+ */
+    static bool entryLess(const StockEntry& lhs, const StockEntry& rhs);
+
+/**---------------------- destroyItem() ---------------------------------------
+ * Deletes a piece of merchandise owned by this Inventory. Passed to a
+ * partition traversal when this Inventory is destroyed.
+ * @param searchKey  The search key under which item is stored.
+ * @param item  The merchandise to delete.
+ * @pre item was allocated by this Inventory.
+ * @post item is deleted and set to NULL.
  */
-    int hashIndex(const Merch *item) const;
+    static void destroyItem(const ItemKey& searchKey, Merch*& item);
 
 }; // end class Inventory
 
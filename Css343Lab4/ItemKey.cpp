@@ -0,0 +1,97 @@
+/*
+ * @file    ItemKey.cpp
+ * @brief   A typed search key by which merchandise is sorted. The key has
+ *          three parts, compared in order: a major text, a packed unsigned
+ *          number and a minor text. Each kind of merchandise fills in the
+ *          parts it sorts by and leaves the others empty or 0; a classic
+ *          movie packs its year and month into the number and puts its major
+ *          actor in the minor text, a comedy uses its title and year, and a
+ *          drama its director and title. The texts are views into the shared
+ *          StringArena, where equal texts are stored once, so two keys that
+ *          share a text compare it by address without reading it, and no key
+ *          ever needs a string of its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#include "ItemKey.h"
+
+
+ItemKey::ItemKey() : packed(0)
+{
+} // end Default Constructor
+
+ItemKey::ItemKey(const TextRef& newMajor, uint32_t newPacked,
+                 const TextRef& newMinor) :
+    major(newMajor), packed(newPacked), minor(newMinor)
+{
+} // end Constructor
+
+int ItemKey::compare(const ItemKey& rhs) const
+{
+    int result = compareText(major, rhs.major);
+
+    if (result != 0)
+    {
+        return result;
+    } // end if (result != 0)
+
+    if (packed != rhs.packed)
+    {
+        return (packed < rhs.packed ? -1 : 1);
+    } // end if (packed != rhs.packed)
+
+    return compareText(minor, rhs.minor);
+} // end compare(ItemKey&)
+
+bool ItemKey::operator==(const ItemKey& rhs) const
+{
+    return compare(rhs) == 0;
+} // end operator==(ItemKey&)
+
+bool ItemKey::operator!=(const ItemKey& rhs) const
+{
+    return compare(rhs) != 0;
+} // end operator!=(ItemKey&)
+
+bool ItemKey::operator<(const ItemKey& rhs) const
+{
+    return compare(rhs) < 0;
+} // end operator<(ItemKey&)
+
+size_t ItemKey::hash(void) const
+{
+    size_t result = major.hash();
+
+    // the length of the major text keeps its characters from running into
+    // the number and minor text when the parts are hashed as one
+    result = (result ^ major.length()) * TEXTHASHPRIME;
+    result = (result ^ packed) * TEXTHASHPRIME;
+
+    return minor.hash(result);
+} // end hash()
+
+TextRef ItemKey::getMajor(void) const
+{
+    return major;
+} // end getMajor()
+
+uint32_t ItemKey::getPacked(void) const
+{
+    return packed;
+} // end getPacked()
+
+TextRef ItemKey::getMinor(void) const
+{
+    return minor;
+} // end getMinor()
+
+int ItemKey::compareText(const TextRef& lhs, const TextRef& rhs)
+{
+    if (lhs.data() == rhs.data() && lhs.length() == rhs.length())
+    {
+        return 0;       // the same stored text, or both empty
+    } // end if (lhs.data() == rhs.data() && ...)
+
+    return lhs.compare(rhs);
+} // end compareText(TextRef&, TextRef&)
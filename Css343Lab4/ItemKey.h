@@ -0,0 +1,162 @@
+/*
+ * @file    ItemKey.h
+ * @brief   A typed search key by which merchandise is sorted. The key has
+ *          three parts, compared in order: a major text, a packed unsigned
+ *          number and a minor text. Each kind of merchandise fills in the
+ *          parts it sorts by and leaves the others empty or 0; a classic
+ *          movie packs its year and month into the number and puts its major
+ *          actor in the minor text, a comedy uses its title and year, and a
+ *          drama its director and title. The texts are views into the shared
+ *          StringArena, where equal texts are stored once, so two keys that
+ *          share a text compare it by address without reading it, and no key
+ *          ever needs a string of its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _ITEMKEY_H
+#define	_ITEMKEY_H
+
+#include <cstdint>
+#include <functional>
+#include "StringArena.h"
+
+
+class ItemKey
+{
+public:
+
+/**---------------------- Default Constructor ---------------------------------
+ * Creates an ItemKey whose parts are all empty. It sorts before any key with
+ * a part that is not.
+ * @pre None.
+ * @post An empty ItemKey exists.
+ */
+    ItemKey();
+
+/**---------------------- Constructor -----------------------------------------
+ * Creates an ItemKey from its parts.
+ * @param newMajor  The part compared first.
+ * @param newPacked  The part compared when the major parts are equal.
+ * @param newMinor  The part compared when the other parts are equal.
+ * @pre The texts are in an arena that outlives this key.
+ * @post An ItemKey exists with the given parts.
+ */
+    ItemKey(const TextRef& newMajor, uint32_t newPacked,
+            const TextRef& newMinor);
+
+/**---------------------- compare() -------------------------------------------
+ * Orders this ItemKey against another one, part by part.
+ * @param rhs  The ItemKey to compare with this one.
+ * @pre None.
+ * @post None.
+ * @return A negative number if this key comes before rhs, zero if they are
+ *         equal, or a positive number otherwise.
+ */
+    int compare(const ItemKey& rhs) const;
+
+/**---------------------- operator==() ----------------------------------------
+ * Compares this ItemKey with another one for equality.
+ * @param rhs  The ItemKey to compare with this one for equality.
+ * @pre None.
+ * @post None.
+ * @return true if every part of this key equals that of rhs; false,
+ *         otherwise.
+ */
+    bool operator==(const ItemKey& rhs) const;
+
+/**---------------------- operator!=() ----------------------------------------
+ * Compares this ItemKey with another one for inequality.
+ * @param rhs  The ItemKey to compare with this one for inequality.
+ * @pre None.
+ * @post None.
+ * @return true if any part of this key differs from that of rhs; false,
+ *         otherwise.
+ */
+    bool operator!=(const ItemKey& rhs) const;
+
+/**---------------------- operator<() -----------------------------------------
+ * Determines whether this ItemKey comes before another one.
+ * @param rhs  The ItemKey to compare with this one.
+ * @pre None.
+ * @post None.
+ * @return true if this key comes before rhs; false, otherwise.
+ */
+    bool operator<(const ItemKey& rhs) const;
+
+/**---------------------- hash() ----------------------------------------------
+ * Hashes every part of this ItemKey, so that equal keys hash alike.
+ * @pre None.
+ * @post None.
+ * @return The hash of this key.
+ */
+    size_t hash(void) const;
+
+/**---------------------- getMajor() ------------------------------------------
+ * Retrieves the part of this ItemKey that is compared first.
+ * @pre None.
+ * @post None.
+ * @return A view of the major text.
+ */
+    TextRef getMajor(void) const;
+
+/**---------------------- getPacked() -----------------------------------------
+ * Retrieves the number part of this ItemKey.
+ * @pre None.
+ * @post None.
+ * @return The packed number.
+ */
+    uint32_t getPacked(void) const;
+
+/**---------------------- getMinor() ------------------------------------------
+ * Retrieves the part of this ItemKey that is compared last.
+ * @pre None.
+ * @post None.
+ * @return A view of the minor text.
+ */
+    TextRef getMinor(void) const;
+
+private:
+
+/**---------------------- compareText() ---------------------------------------
+ * Orders two texts, taking equal views as equal without reading them.
+ * @param lhs  The first text.
+ * @param rhs  The second text.
+ * @pre None.
+ * @post None.
+ * @return A negative number if lhs comes before rhs, zero if they are equal,
+ *         or a positive number otherwise.
+ */
+    static int compareText(const TextRef& lhs, const TextRef& rhs);
+
+    TextRef  major;             // compared first
+    uint32_t packed;            // compared second
+    TextRef  minor;             // compared last
+
+}; // end class ItemKey
+
+
+/** Orders two ItemKeys for a tree with one comparison per level, rather than
+ *  the two that the default keyOrder() would make.
+ */
+inline int keyOrder(const KeyLess&, const ItemKey& lhs, const ItemKey& rhs)
+{
+    return lhs.compare(rhs);
+} // end keyOrder(KeyLess&, ItemKey&, ItemKey&)
+
+
+namespace std
+{
+    /** Lets an ItemKey be the key of a hash container.
+     */
+    template <>
+    struct hash<ItemKey>
+    {
+        size_t operator()(const ItemKey& key) const
+        {
+            return key.hash();
+        } // end operator()(ItemKey&)
+    }; // end hash<ItemKey>
+} // end namespace std
+
+#endif	/* _ITEMKEY_H */
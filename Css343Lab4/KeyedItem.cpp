@@ -4,60 +4,70 @@
  *          Carrano, F. M. (2007). Trees. In M. Hirsch (Ed.) "Data Abstraction
  *              & Problem Solving with C++: Walls and Mirrors" (5th ed.) p.
  *              555. Boston, MA: Pearson Education, Inc.
- * @brief   KeyedItem class for the threaded binary search tree. Only contains
- *          the search key value. Needs to be changed or subclassed to add
- *          other data elements.
+ * @brief   KeyedItem class for passing a field of information, a search key
+ *          and its value, to and from the classes that store such fields.
+ *          The fields themselves are kept in threaded binary search trees
+ *          keyed by KeyType.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
 
+#include <utility>
 #include "KeyedItem.h"
-#include "Merch.h"
 
 
 KeyedItem::KeyedItem() :
-             itemPtr(NULL), searchKey(""), value("")
+             searchKey(""), value("")
 {
 } // end Default Constructor
 
 KeyedItem::KeyedItem(const KeyType& newSearchKey) :
-             itemPtr(NULL), searchKey(newSearchKey), value("")
+             searchKey(newSearchKey), value("")
 {
 } // end Constructor (Key)
 
 KeyedItem::KeyedItem(const KeyType& newSearchKey, const ValueType& newValue) :
-           itemPtr(NULL), searchKey(newSearchKey), value(newValue)
+           searchKey(newSearchKey), value(newValue)
 {
 } // end Constructor (Key / Value)
 
-KeyedItem::KeyedItem(const Merch *newItemPtr) :
-             itemPtr(NULL), searchKey(""), value("")
-{
-    if (newItemPtr != NULL)
-    {
-        itemPtr = newItemPtr->copy();
-        searchKey = itemPtr->getSearchKey();
-    } // end if (newItemPtr != NULL)
-} // end Constructor (Item)
-
 KeyedItem::KeyedItem(const KeyedItem& orig) :
-             itemPtr(NULL), searchKey(orig.searchKey), value(orig.value)
+             searchKey(orig.searchKey), value(orig.value)
 {
-    if (orig.itemPtr != NULL)
-    {
-        itemPtr = orig.itemPtr->copy();
-    } // end if (orig.itemPtr != NULL)
 } // end Copy Constructor
 
+KeyedItem::KeyedItem(KeyedItem&& orig) :
+             searchKey(move(orig.searchKey)), value(move(orig.value))
+{
+    orig.searchKey.clear();
+    orig.value.clear();
+} // end Move Constructor
+
 KeyedItem::~KeyedItem()
 {
-    if (itemPtr != NULL)
-    {
-        delete itemPtr;
-        itemPtr = NULL;
-    }
 } // end Destructor
 
+KeyedItem& KeyedItem::operator=(const KeyedItem& rhs)
+{
+    searchKey = rhs.searchKey;
+    value = rhs.value;
+
+    return *this;
+} // end operator=(KeyedItem&)
+
+KeyedItem& KeyedItem::operator=(KeyedItem&& rhs)
+{
+    if (this != &rhs)   // moving into itself would empty this item
+    {
+        searchKey = move(rhs.searchKey);
+        value = move(rhs.value);
+        rhs.searchKey.clear();
+        rhs.value.clear();
+    } // end if (this != &rhs)
+
+    return *this;
+} // end operator=(KeyedItem&&)
+
 bool KeyedItem::operator==(const KeyedItem& rhs) const
 {
     return searchKey == rhs.searchKey;
@@ -95,16 +105,18 @@ KeyType KeyedItem::getKey(void) const
 
 bool KeyedItem::setKey(const KeyType& newSearchKey)
 {
-    bool success = itemPtr == NULL;
-
-    if (success)
-    {
-        searchKey = newSearchKey;
-    } // end if (success)
+    searchKey = newSearchKey;
 
-    return success;
+    return true;
 } // end setKey(KeyType&)
 
+bool KeyedItem::setKey(KeyType&& newSearchKey)
+{
+    searchKey = move(newSearchKey);
+
+    return true;
+} // end setKey(KeyType&&)
+
 ValueType KeyedItem::getValue(void) const
 {
     return value;
@@ -115,12 +127,7 @@ void KeyedItem::setValue(const ValueType& newValue)
     value = newValue;
 } // end setValue(ValueType&)
 
-Merch* KeyedItem::getItem(void) const
+void KeyedItem::setValue(ValueType&& newValue)
 {
-    if (itemPtr == NULL)
-    {
-        return NULL;
-    } // end if (itemPtr == NULL)
-
-    return itemPtr->copy();
-} // end getItem()
+    value = move(newValue);
+} // end setValue(ValueType&&)
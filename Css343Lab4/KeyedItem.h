@@ -4,9 +4,10 @@
  *          Carrano, F. M. (2007). Trees. In M. Hirsch (Ed.) "Data Abstraction
  *              & Problem Solving with C++: Walls and Mirrors" (5th ed.) p.
  *              555. Boston, MA: Pearson Education, Inc.
- * @brief   KeyedItem class for the threaded binary search tree. Only contains
- *          the search key value. Needs to be changed or subclassed to add
- *          other data elements.
+ * @brief   KeyedItem class for passing a field of information, a search key
+ *          and its value, to and from the classes that store such fields.
+ *          The fields themselves are kept in threaded binary search trees
+ *          keyed by KeyType.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
@@ -22,8 +23,6 @@ using namespace std;
 typedef string KeyType;
 typedef string ValueType;
 
-class Merch;    // forward declaration to use Merch
-
 
 class KeyedItem
 {
@@ -55,16 +54,6 @@ public:
  */
     KeyedItem(const KeyType& newKey, const ValueType& newValue);
 
-/**---------------------- Constructor (Item) ----------------------------------
- * Creates a KeyedItem object with a set item.
- * @param newItemPtr  A pointer to a piece of Merchandise to copy into this
- *                    Keyed Item.
- * @pre None.
- * @post A KeyeedItem object exists and its item is a copy of the object that
- *       newItemPtr points to.
- */
-    KeyedItem(const Merch *newItemPtr);
-
 /**---------------------- Copy Constructor ------------------------------------
  * Creates a KeyedItem object that is a copy of another one.
  * @param orig  The Keyed Item to be copied.
@@ -73,13 +62,43 @@ public:
  */
     KeyedItem(const KeyedItem& orig);
 
+/**---------------------- Move Constructor ------------------------------------
+ * Creates a KeyedItem object that takes over the key and value of another
+ * one, without copying them.
+ * @param orig  The Keyed Item whose key and value are taken.
+ * @pre None.
+ * @post A KeyedItem object exists with the key and value orig had; orig is
+ *       left with an empty key and value.
+ */
+    KeyedItem(KeyedItem&& orig);
+
 /**---------------------- Destructor ------------------------------------------
  * Deletes all elements of this Keyed Item.
  * @pre None.
- * @post The item has been deleted and its pointer set to NULL.
+ * @post None.
  */
     ~KeyedItem();
 
+/**---------------------- operator=() -----------------------------------------
+ * Copies the key and value of another Keyed Item into this one.
+ * @param rhs  The Keyed Item to be copied.
+ * @pre None.
+ * @post This Keyed Item is a copy of rhs.
+ * @return This Keyed Item.
+ */
+    KeyedItem& operator=(const KeyedItem& rhs);
+
+/**---------------------- operator=() (Move) ----------------------------------
+ * Moves the key and value of another Keyed Item into this one, without
+ * copying them.
+ * @param rhs  The Keyed Item whose key and value are taken.
+ * @pre None.
+ * @post This Keyed Item has the key and value rhs had; rhs is left with an
+ *       empty key and value.
+ * @return This Keyed Item.
+ */
+    KeyedItem& operator=(KeyedItem&& rhs);
+
 /**---------------------- operator==() ----------------------------------------
  * Compares this KeyedItem with another one for equality.
  * @param rhs  The Keyed Item to compare with this one for equality.
@@ -161,6 +180,17 @@ public:
  */
     bool setKey(const KeyType& newKey);
 
+/**---------------------- setKey() (Move) -------------------------------------
+ * Sets the key of this Keyed Item, taking the new key's storage rather than
+ * copying it.
+ * @parm newKey  The new key value to use when sorting this Keyed Item.
+ * @pre None.
+ * @post The search key for this Keyed Item is now what newKey held; newKey is
+ *       left in a valid but unspecified state.
+ * @return true if the new key is acceptable; false, otherwise.
+ */
+    bool setKey(KeyType&& newKey);
+
 /**---------------------- getValue() ------------------------------------------
  * Gets the value of this Keyed Item.
  * @pre This item has a value to complement its search key.
@@ -176,19 +206,17 @@ public:
  */
     void setValue(const ValueType& newValue);
 
-/**---------------------- getItem() -------------------------------------------
- * Provides a pointer to a copy of the Merchandise pointed to by this Keyed
- * Item.
+/**---------------------- setValue() (Move) -----------------------------------
+ * Sets the value of this Keyed Item, taking the new value's storage rather
+ * than copying it.
  * @pre None.
- * @post None.
- * @return A Merch pointer to a new piece of Merchandise that is a copy of the
- *         one held by this Keyed Item.
+ * @post The value for this Keyed Item is now what newValue held; newValue is
+ *       left in a valid but unspecified state.
  */
-    Merch* getItem(void) const;
+    void setValue(ValueType&& newValue);
 
 private:
 
-    Merch     *itemPtr;     // pointer to some piece of merchandise
     KeyType    searchKey;   // searchable key for this item
     ValueType  value;       // some value to match the search key
 
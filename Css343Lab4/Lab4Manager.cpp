@@ -8,6 +8,7 @@
  * @date    March 9, 2012
  */
 
+#include <utility>
 #include "Lab4Manager.h"
 #include "DVDFactory.h"
 #include "DVDMedia.h"
@@ -25,8 +26,8 @@ Lab4Manager::~Lab4Manager()
 void Lab4Manager::buildInventory(const char* filename)
 {
     DVDFactory  DVDMaker;
-    KeyedItem   searchKey;
     DVDMedia   *tempPtr = NULL;
+    vector<Merch*> movies;          // stocked together once all are read
     ifstream    infile(filename);
     string      director, title;
     char        genreCode;
@@ -39,13 +40,8 @@ void Lab4Manager::buildInventory(const char* filename)
     
     infile >> genreCode;    // look for first genre code character
 
-    for (;;)    // go until finished
+    while (!infile.eof())   // go until finished
     {
-        if (infile.eof())   // done reading input
-        {
-            return;
-        } // end if (infile.eof())
-
         infile.get();                       // discard white space
         getline(infile, director, ',');     // get name of director
 
@@ -59,26 +55,13 @@ void Lab4Manager::buildInventory(const char* filename)
 
         if (tempPtr != NULL)    // there is a movie to work with
         {
-            if (searchKey.setKey("Director"))   // director field can be set
-            {
-                searchKey.setValue(director);
-            } // end if (searchKey.setKey("Director"))
-
-            tempPtr->setField(searchKey);       // set the director field
-
-            if (searchKey.setKey("Title"))      // title field can be set
-            {
-                searchKey.setValue(title);
-            } // end if (searchKey.setKey("Title"))
-
-            tempPtr->setField(searchKey);   // set the title field
+            tempPtr->setField(DIRECTORFIELD, move(director));
+            tempPtr->setField(TITLEFIELD, move(title));
             tempPtr->setStockQty(10);       // default stock quantity
             tempPtr->setOnHandQty(10);      // default available quantity
             tempPtr->updateSearchKey();     // ensure search key is valid
 
-            scarecrow.addItem(tempPtr);     // copy new item into store
-
-            delete tempPtr;     // should be no other references to tempPtr
+            movies.push_back(tempPtr);      // hold until the batch is read
             tempPtr = NULL;
         }
         else
@@ -88,12 +71,13 @@ void Lab4Manager::buildInventory(const char* filename)
         } // if (tempPtr != NULL)
 
         infile >> genreCode;    // look for next genre code character
-    } // end for (;;)
+    } // end while (!infile.eof())
+
+    scarecrow.addItems(move(movies));   // store takes the movies as they are
 } // end buildInventory(char*)
 
 void Lab4Manager::buildCustomers(const char* filename)
 {
-    KeyedItem  searchKey;
     Customer   tempCust;
     ifstream   infile(filename);
     string     nameFirst, nameLast;
@@ -120,19 +104,8 @@ void Lab4Manager::buildCustomers(const char* filename)
 
             infile >> nameLast >> nameFirst;
 
-            if (searchKey.setKey("First Name"))     // name field can be set
-            {
-                searchKey.setValue(nameFirst);
-            }
-
-            tempCust.setField(searchKey);           // set name field
-
-            if (searchKey.setKey("Last Name"))      // name field can be set
-            {
-                searchKey.setValue(nameLast);
-            }
-
-            tempCust.setField(searchKey);           // set name field
+            tempCust.setField(FIRSTNAMEFIELD, nameFirst);   // set name fields
+            tempCust.setField(LASTNAMEFIELD, nameLast);
 
             scarecrow.addCustomer(tempCust);        // add customer to store
         }
@@ -4,20 +4,28 @@
  *          shop. Merchandise maintains a set of attributes about itself, in
  *          key-value pairs. In order to be sortable, any merchandise in a
  *          collection must contain at least one mutual key by which the items
- *          may be sorted.
+ *          may be sorted. A derived class may keep the fields it always has
+ *          in typed members of its own by overriding readField() and
+ *          writeField(); any other field is kept in a tree of key-value pairs.
+ *          The quantity on hand is an atomic counter, so copies of the same
+ *          merchandise may be checked out and in from several threads at once
+ *          without a lock.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
 
 #include <iostream>
+#include <utility>
 #include "Merch.h"
 
 
-Merch::Merch()
+atomic<int> Merch::fieldMisses(0);
+
+Merch::Merch() : stockQty(0), onHandQty(0)
 {
 } // end Default Constructor
 
-Merch::Merch(const string& searchKey)
+Merch::Merch(const string& searchKey) : stockQty(0), onHandQty(0)
 {
 } // end Constructor (Key)
 
@@ -27,10 +35,57 @@ Merch::Merch(const KeyType& newKey, const KeyType& newValue,
 {
 } // end Constructor
 
+Merch::Merch(const Merch& orig) :
+    searchKey(orig.searchKey), itemKey(orig.itemKey),
+    stockQty(orig.stockQty.load()), onHandQty(orig.onHandQty.load()),
+    info(orig.info)
+{
+} // end Copy Constructor
+
+Merch::Merch(Merch&& orig) :
+    searchKey(move(orig.searchKey)), itemKey(orig.itemKey),
+    stockQty(orig.stockQty.load()), onHandQty(orig.onHandQty.load()),
+    info(move(orig.info))
+{
+} // end Move Constructor
+
 Merch::~Merch()
 {
 } // end Destructor
 
+Merch& Merch::operator=(const Merch& rhs)
+{
+    if (this != &rhs)
+    {
+        searchKey = rhs.searchKey;
+        itemKey = rhs.itemKey;
+        stockQty = rhs.stockQty.load();
+        onHandQty = rhs.onHandQty.load();
+        info = rhs.info;
+    } // end if (this != &rhs)
+
+    return *this;
+} // end operator=(Merch&)
+
+Merch& Merch::operator=(Merch&& rhs)
+{
+    if (this != &rhs)
+    {
+        searchKey = move(rhs.searchKey);
+        itemKey = rhs.itemKey;
+        stockQty = rhs.stockQty.load();
+        onHandQty = rhs.onHandQty.load();
+        info = move(rhs.info);
+    } // end if (this != &rhs)
+
+    return *this;
+} // end operator=(Merch&&)
+
+void Merch::assign(const Merch& source)
+{
+    *this = source;
+} // end assign(Merch&)
+
 string Merch::getSearchKey(void) const
 {
     return searchKey;
@@ -41,6 +96,16 @@ void Merch::setSearchKey(const string& newSearchKey)
     searchKey = newSearchKey;
 } // end setKey(string&)
 
+const ItemKey& Merch::getItemKey(void) const
+{
+    return itemKey;
+} // end getItemKey()
+
+void Merch::setItemKey(const ItemKey& newItemKey)
+{
+    itemKey = newItemKey;
+} // end setItemKey(ItemKey&)
+
 int Merch::getStockQty(void) const
 {
     return stockQty;
@@ -75,33 +140,126 @@ bool Merch::setOnHandQty(int newQty)
     return success;
 } // end setOnHandQty(int)
 
+bool Merch::checkOut(void)
+{
+    int onHand = onHandQty.load();
+
+    // a failed exchange reloads onHand, so the test is made again
+    do
+    {
+        if (onHand <= 1)
+        {
+            return false;   // the last copy stays on hand
+        } // end if (onHand <= 1)
+    } while (!onHandQty.compare_exchange_weak(onHand, onHand - 1));
+
+    return true;
+} // end checkOut()
+
+bool Merch::checkIn(void)
+{
+    int onHand = onHandQty.load();
+
+    do
+    {
+        if (onHand >= stockQty.load())
+        {
+            return false;   // no copy of this item is out
+        } // end if (onHand >= stockQty.load())
+    } while (!onHandQty.compare_exchange_weak(onHand, onHand + 1));
+
+    return true;
+} // end checkIn()
+
 bool Merch::getField(KeyedItem& target) const
+{
+    FieldID   field = FieldAtom::find(target.getKey());
+    ValueType fieldValue;
+
+    if (field == NOFIELD)   // no item has a field by this name
+    {
+        fieldMisses.fetch_add(1, memory_order_relaxed);
+        return false;
+    } // end if (field == NOFIELD)
+
+    if (getField(field, fieldValue))
+    {
+        target.setValue(fieldValue);
+        return true;
+    } // end if (getField(field, fieldValue))
+
+    return false;
+} // end getField(KeyedItem&)
+
+bool Merch::getField(FieldID field, ValueType& fieldValue) const
+{
+    if (readField(field, fieldValue) || info.tryRetrieve(field, fieldValue))
+    {
+        return true;
+    } // end if (readField(field, fieldValue) || ...)
+
+    // Desired field does not exist in this Merchandise
+    fieldMisses.fetch_add(1, memory_order_relaxed);
+    return false;
+} // end getField(FieldID, ValueType&)
+
+int Merch::getFieldMisses(void)
+{
+    return fieldMisses.load(memory_order_relaxed);
+} // end getFieldMisses()
+
+void Merch::setField(const KeyedItem& newValue)
 {
     try
     {
-        info.searchTreeRetrive(target.getKey(), target);
+        setField(FieldAtom::intern(newValue.getKey()), newValue.getValue());
     }
     catch (TreeException e)
     {
-        cout << "ERROR: Could not find field ";
-        target.getItem()->display();
-        cout << " in item " << searchKey << endl;
-        return false;   // Desired field does not exist in this Merchandise
+        cout << "ERROR: Could not set field " << newValue.getKey()
+             << " in item " << searchKey << endl;
     } // end try
+} // end setField(KeyedItem&)
 
-    return true;
-} // end getField(KeyedItem&)
+void Merch::setField(FieldID field, const ValueType& newValue)
+{
+    setField(field, ValueType(newValue));
+} // end setField(FieldID, ValueType&)
 
-void Merch::setField(const KeyedItem& newValue)
+void Merch::setField(FieldID field, ValueType&& newValue)
 {
+    ValueType *fieldValue;
+
+    if (writeField(field, newValue))    // kept by the derived class
+    {
+        return;
+    } // end if (writeField(field, newValue))
+
+    fieldValue = info.findMutable(field);
+
+    if (fieldValue != NULL)     // field exists; change its value in place
+    {
+        *fieldValue = move(newValue);
+        return;
+    } // end if (fieldValue != NULL)
+
     try
     {
-        info.searchTreeInsert(newValue);
+        info.searchTreeInsert(FieldID(field), move(newValue));
     }
     catch (TreeException e)
     {
-        cout << "ERROR: Could not set field ";
-        newValue.getItem()->display();
-        cout << " in item " << searchKey << endl;
+        cout << "ERROR: Could not set field " << FieldAtom::nameOf(field)
+             << " in item " << searchKey << endl;
     } // end try
-} // end setField()
+} // end setField(FieldID, ValueType&&)
+
+bool Merch::readField(FieldID, ValueType&) const
+{
+    return false;   // every field is kept in the field tree
+} // end readField(FieldID, ValueType&)
+
+bool Merch::writeField(FieldID, ValueType&)
+{
+    return false;   // every field is kept in the field tree
+} // end writeField(FieldID, ValueType&)
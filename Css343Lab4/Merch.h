@@ -4,7 +4,12 @@
  *          shop. Merchandise maintains a set of attributes about itself, in
  *          key-value pairs. In order to be sortable, any merchandise in a
  *          collection must contain at least one mutual key by which the items
- *          may be sorted.
+ *          may be sorted. A derived class may keep the fields it always has
+ *          in typed members of its own by overriding readField() and
+ *          writeField(); any other field is kept in a tree of key-value pairs.
+ *          The quantity on hand is an atomic counter, so copies of the same
+ *          merchandise may be checked out and in from several threads at once
+ *          without a lock.
  * @author  Brendan Sweeney, SID 1161836
  * @date    March 9, 2012
  */
@@ -12,6 +17,10 @@
 #ifndef _MERCH_H
 #define	_MERCH_H
 
+#include <atomic>
+#include "FieldAtom.h"
+#include "ItemKey.h"
+#include "KeyedItem.h"
 #include "ThreadedBST.h"
 
 
@@ -26,7 +35,56 @@ public:
     Merch(const KeyType& newKey, const KeyType& newValue,
             int newStockQty, int newOnHandQty);
 
-    ~Merch();
+/**---------------------- Copy Constructor ------------------------------------
+ * Creates a Merch object that is a copy of another one. The fields of orig are
+ * copied node for node, without searching or rebalancing.
+ * @param orig  The Merchandise to be copied.
+ * @pre None.
+ * @post This Merch has the search key, quantities and fields of orig.
+ */
+    Merch(const Merch& orig);
+
+/**---------------------- Move Constructor ------------------------------------
+ * Creates a Merch object that takes over the search key and fields of another
+ * one, without copying them.
+ * @param orig  The Merchandise whose search key and fields are taken.
+ * @pre None.
+ * @post This Merch has the search key, quantities and fields orig had; orig
+ *       has no fields.
+ */
+    Merch(Merch&& orig);
+
+    virtual ~Merch();
+
+/**---------------------- operator=() -----------------------------------------
+ * Copies the search key, quantities and fields of another Merch into this one.
+ * @param rhs  The Merchandise to be copied.
+ * @pre None.
+ * @post This Merch is a copy of rhs.
+ * @return This Merch.
+ */
+    Merch& operator=(const Merch& rhs);
+
+/**---------------------- operator=() (Move) ----------------------------------
+ * Moves the search key and fields of another Merch into this one, without
+ * copying them.
+ * @param rhs  The Merchandise whose search key and fields are taken.
+ * @pre None.
+ * @post This Merch has the search key, quantities and fields rhs had; rhs
+ *       has no fields.
+ * @return This Merch.
+ */
+    Merch& operator=(Merch&& rhs);
+
+/**---------------------- assign() --------------------------------------------
+ * Copies another Merch of the same kind into this one, through a base class
+ * pointer. Unlike operator=(), a derived class overrides this to copy the
+ * fields it keeps in typed members, as well.
+ * @param source  The Merchandise to be copied; of the same class as this one.
+ * @pre None.
+ * @post This Merch has the search key, quantities and fields of source.
+ */
+    virtual void assign(const Merch& source);
 
     virtual bool updateSearchKey(void) = 0;
 
@@ -40,6 +98,22 @@ public:
 
     void setSearchKey(const string& newSearchKey);
 
+/**---------------------- getItemKey() ----------------------------------------
+ * Retrieves the typed search key by which this Merch is sorted and found.
+ * @pre None.
+ * @post None.
+ * @return The typed search key; empty until updateSearchKey() is called.
+ */
+    const ItemKey& getItemKey(void) const;
+
+/**---------------------- setItemKey() ----------------------------------------
+ * Sets the typed search key by which this Merch is sorted and found.
+ * @param newItemKey  The new typed search key.
+ * @pre None.
+ * @post This Merch is sorted and found by newItemKey.
+ */
+    void setItemKey(const ItemKey& newItemKey);
+
 /**---------------------- getStockQty() ---------------------------------------
  * Retrieves the quantity of each type of merchandise this Inventory can hold.
  * @pre None.
@@ -74,18 +148,61 @@ public:
  */
     bool setOnHandQty(int newOnHandQty);
 
+/**---------------------- checkOut() ------------------------------------------
+ * Takes one copy of this merchandise off hand, in a single atomic step. The
+ * last copy is never taken, as setOnHandQty() does not allow a quantity of 0.
+ * @pre None.
+ * @post The quantity on hand is one less, if this returned true; otherwise it
+ *       is unchanged.
+ * @return true if a copy was taken; false, if only one was on hand.
+ */
+    bool checkOut(void);
+
+/**---------------------- checkIn() -------------------------------------------
+ * Puts one copy of this merchandise back on hand, in a single atomic step.
+ * @pre None.
+ * @post The quantity on hand is one more, if this returned true; otherwise it
+ *       is unchanged.
+ * @return true if a copy was put back; false, if every copy stocked was
+ *         already on hand.
+ */
+    bool checkIn(void);
+
 /**---------------------- getField() ------------------------------------------
  * Retrieves the value of a specified field of this Merch's information.
  * @param target  A key-value pair whose key matches a key in this Merch's
  *                information. Will be updated with the corresponding value, if
  *                found.
- * @pre This Merchandise has a value in the specified field.
- * @post target contains the located value.
+ * @pre None.
+ * @post target contains the located value. A missing field is counted
+ *       rather than reported.
  * @return true if this Merch has a value in the specified field and target was
  *         updated with that value; false, otherwise.
  */
     bool getField(KeyedItem& target) const;
 
+/**---------------------- getField() (Atom) ----------------------------------
+ * Retrieves the value of a specified field of this Merch's information by the
+ * atom of its name, without building a KeyedItem or comparing strings.
+ * @param field  The atom of the field to look up.
+ * @param fieldValue  A container for the corresponding value, if found.
+ * @pre None.
+ * @post fieldValue contains the located value. A missing field is counted
+ *       rather than reported.
+ * @return true if this Merch has a value in the specified field and
+ *         fieldValue was updated with that value; false, otherwise.
+ */
+    bool getField(FieldID field, ValueType& fieldValue) const;
+
+/**---------------------- getFieldMisses() ------------------------------------
+ * Retrieves the number of times getField() has not found a field in any Merch
+ * since the program started.
+ * @pre None.
+ * @post None.
+ * @return The number of fields looked up and not found.
+ */
+    static int getFieldMisses(void);
+
 /**---------------------- setField() ------------------------------------------
  * Sets the value of a specified field of this Merch's information to a
  * specified value. If the field does not exist, it is created. Once a field
@@ -98,12 +215,62 @@ public:
  */
     void setField(const KeyedItem& newValue);
 
+/**---------------------- setField() (Atom) ----------------------------------
+ * Sets the value of a specified field of this Merch's information by the atom
+ * of its name. If the field does not exist, it is created.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to store in the field.
+ * @pre None.
+ * @post This Merch contains the field with the value newValue.
+ */
+    void setField(FieldID field, const ValueType& newValue);
+
+/**---------------------- setField() (Atom / Move) ---------------------------
+ * Sets the value of a specified field of this Merch's information by the atom
+ * of its name, taking over the storage of the new value.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to move into the field; left empty.
+ * @pre None.
+ * @post This Merch contains the field with the value newValue had.
+ */
+    void setField(FieldID field, ValueType&& newValue);
+
+protected:
+
+/**---------------------- readField() -----------------------------------------
+ * Retrieves the value of a field that a derived class keeps in a typed member
+ * of its own. Called by getField() before the field tree is searched.
+ * @param field  The atom of the field to look up.
+ * @param fieldValue  A container for the value of the field, if found.
+ * @pre None.
+ * @post fieldValue contains the value of the field, if it is kept in a typed
+ *       member and has been set.
+ * @return true if fieldValue was updated; false, if the field tree should be
+ *         searched instead. This version always returns false.
+ */
+    virtual bool readField(FieldID field, ValueType& fieldValue) const;
+
+/**---------------------- writeField() ----------------------------------------
+ * Stores the value of a field that a derived class keeps in a typed member of
+ * its own. Called by setField() before the field tree is changed.
+ * @param field  The atom of the field to set.
+ * @param newValue  The value to store; may be moved from if it is taken.
+ * @pre None.
+ * @post If the field is kept in a typed member, that member holds newValue.
+ * @return true if the value was taken; false, if it should be kept in the
+ *         field tree instead. This version always returns false.
+ */
+    virtual bool writeField(FieldID field, ValueType& newValue);
+
 private:
 
-    string      searchKey;  // search key for sorting
-    int         stockQty;   // quantity of this item that is normally stocked
-    int         onHandQty;  // quantity of this item that is available
-    ThreadedBST info;       // collection of attributes in key-value pairs
+    string      searchKey;  // search key for display
+    ItemKey     itemKey;    // search key for sorting and lookup
+    atomic<int> stockQty;   // quantity of this item that is normally stocked
+    atomic<int> onHandQty;  // quantity of this item that is available
+    ThreadedBST<FieldID, ValueType> info;   // attributes by field atom
+
+    static atomic<int> fieldMisses;     // fields not found, in any Merch
 
 }; // end class Merch
 
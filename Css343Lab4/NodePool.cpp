@@ -0,0 +1,148 @@
+/*
+ * @file    NodePool.cpp
+ * @brief   A pooled allocator for the nodes of a single container. Storage is
+ *          obtained from the heap in slabs that each hold many nodes, so
+ *          nodes that are allocated together sit together in memory. A node
+ *          that is given back goes onto a free list and is handed out again
+ *          before any new slab is requested. Slabs are only returned to the
+ *          heap when the pool itself is destroyed. Being a template, this file
+ *          is included by NodePool.h rather than compiled on its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _NODEPOOL_CPP
+#define	_NODEPOOL_CPP
+
+#include <cstddef>          // definition of NULL
+
+#include "NodePool.h"
+
+using namespace std;
+
+
+template <class Item>
+NodePool<Item>::NodePool() :
+                freeList(NULL), nextChunk(NULL), slabEnd(NULL),
+                slabSize(FIRSTSLABSIZE)
+{
+} // end default constructor
+
+template <class Item>
+NodePool<Item>::~NodePool()
+{
+    for (size_t i = 0; i < slabs.size(); ++i)
+    {
+        ::operator delete(slabs[i]);
+    } // end for (i < slabs.size())
+
+    freeList = NULL;
+    nextChunk = NULL;
+    slabEnd = NULL;
+} // end destructor
+
+/** Provides uninitialized storage for one Item.
+ * @pre None.
+ * @post A chunk of storage large enough for an Item is reserved for the
+ *       caller; a new slab is obtained if no chunk is free.
+ * @return A pointer to the reserved storage.
+ * @throw bad_alloc  If a new slab is needed and cannot be allocated.
+ */
+template <class Item>
+void* NodePool<Item>::allocate(void) throw(bad_alloc)
+{
+    void *chunk = freeList;
+
+    if (chunk != NULL)
+    {
+        // reuse the chunk given back most recently
+        freeList = *static_cast<void**>(chunk);
+        return chunk;
+    } // end if (chunk != NULL)
+
+    if (nextChunk == slabEnd)
+    {
+        addSlab();      // current slab is used up
+    } // end if (nextChunk == slabEnd)
+
+    chunk = nextChunk;
+    nextChunk += sizeof(Item);
+
+    return chunk;
+} // end allocate()
+
+/** Returns storage for one Item to this pool.
+ * @param chunk  Storage obtained from allocate() of this pool.
+ * @pre Any Item that occupied chunk has already been destroyed.
+ * @post chunk will be handed out again by a later call to allocate().
+ */
+template <class Item>
+void NodePool<Item>::deallocate(void *chunk)
+{
+    if (chunk != NULL)
+    {
+        // Assert: an Item is at least as large as a pointer
+        *static_cast<void**>(chunk) = freeList;
+        freeList = chunk;
+    } // end if (chunk != NULL)
+} // end deallocate(void*)
+
+/** Exchanges the storage of this pool with that of another.
+ * @param other  The pool whose storage is taken.
+ * @pre None.
+ * @post Each pool owns the slabs, free chunks and reserved chunks the other
+ *       owned before. No storage is copied or released.
+ */
+template <class Item>
+void NodePool<Item>::swap(NodePool& other)
+{
+    void *tempList = freeList;
+    char *tempChunk = nextChunk;
+    char *tempEnd = slabEnd;
+    int   tempSize = slabSize;
+
+    slabs.swap(other.slabs);
+    freeList = other.freeList;
+    nextChunk = other.nextChunk;
+    slabEnd = other.slabEnd;
+    slabSize = other.slabSize;
+    other.freeList = tempList;
+    other.nextChunk = tempChunk;
+    other.slabEnd = tempEnd;
+    other.slabSize = tempSize;
+} // end swap(NodePool&)
+
+/** Obtains a new slab from the heap and makes it the current slab.
+ * @pre None.
+ * @post The current slab has room for at least one more Item. Each slab is
+ *       twice the size of the one before, up to MAXSLABSIZE Items.
+ * @throw bad_alloc  If the slab cannot be allocated.
+ */
+template <class Item>
+void NodePool<Item>::addSlab(void) throw(bad_alloc)
+{
+    // operator new aligns storage for any type; each chunk after the first is
+    // a whole number of Items further on, so every chunk is aligned too
+    char *slab = static_cast<char*>(::operator new(slabSize * sizeof(Item)));
+
+    try
+    {
+        slabs.push_back(slab);
+    }
+    catch (bad_alloc e)
+    {
+        ::operator delete(slab);
+        throw;
+    } // end try
+
+    nextChunk = slab;
+    slabEnd = slab + slabSize * sizeof(Item);
+
+    if (slabSize < MAXSLABSIZE)
+    {
+        slabSize *= 2;
+    } // end if (slabSize < MAXSLABSIZE)
+} // end addSlab()
+
+
+#endif	/* _NODEPOOL_CPP */
@@ -0,0 +1,86 @@
+/*
+ * @file    NodePool.h
+ * @brief   A pooled allocator for the nodes of a single container. Storage is
+ *          obtained from the heap in slabs that each hold many nodes, so
+ *          nodes that are allocated together sit together in memory. A node
+ *          that is given back goes onto a free list and is handed out again
+ *          before any new slab is requested. Slabs are only returned to the
+ *          heap when the pool itself is destroyed. The pool deals in raw
+ *          storage; constructing and destroying the objects placed in it is
+ *          left to the container.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _NODEPOOL_H
+#define	_NODEPOOL_H
+
+#include <new>
+#include <vector>
+
+using namespace std;
+
+const int FIRSTSLABSIZE = 8;    // nodes in the first slab of a pool
+const int MAXSLABSIZE = 1024;   // nodes in any later slab, at most
+
+
+template <class Item>
+class NodePool
+{
+public:
+
+    NodePool();
+
+    virtual ~NodePool();
+
+    /** Provides uninitialized storage for one Item.
+     * @pre None.
+     * @post A chunk of storage large enough for an Item is reserved for the
+     *       caller; a new slab is obtained if no chunk is free.
+     * @return A pointer to the reserved storage.
+     * @throw bad_alloc  If a new slab is needed and cannot be allocated.
+     */
+    void* allocate(void) throw(bad_alloc);
+
+    /** Returns storage for one Item to this pool.
+     * @param chunk  Storage obtained from allocate() of this pool.
+     * @pre Any Item that occupied chunk has already been destroyed.
+     * @post chunk will be handed out again by a later call to allocate().
+     */
+    void deallocate(void *chunk);
+
+    /** Exchanges the storage of this pool with that of another.
+     * @param other  The pool whose storage is taken.
+     * @pre None.
+     * @post Each pool owns the slabs, free chunks and reserved chunks the
+     *       other owned before. No storage is copied or released.
+     */
+    void swap(NodePool& other);
+
+private:
+
+    // copying a pool would leave two pools owning the same slabs
+    NodePool(const NodePool& orig);
+
+    void operator=(const NodePool& rhs);
+
+    /** Obtains a new slab from the heap and makes it the current slab.
+     * @pre None.
+     * @post The current slab has room for at least one more Item. Each slab
+     *       is twice the size of the one before, up to MAXSLABSIZE Items.
+     * @throw bad_alloc  If the slab cannot be allocated.
+     */
+    void addSlab(void) throw(bad_alloc);
+
+    vector<void*> slabs;        // every slab owned by this pool
+    void         *freeList;     // chunks given back, linked through storage
+    char         *nextChunk;    // first never-used chunk of current slab
+    char         *slabEnd;      // one past the last chunk of current slab
+    int           slabSize;     // number of Items in the next slab
+
+}; // end NodePool
+
+
+#include "NodePool.cpp"
+
+#endif	/* _NODEPOOL_H */
@@ -0,0 +1,655 @@
+/*
+ * @file    PersistentBST.cpp
+ * @brief   A balanced binary search tree whose versions are never changed once
+ *          published. A write copies the nodes on the path from the root to
+ *          the item it changes, shares every other node with the previous
+ *          version, and publishes the new root with one atomic store. Readers
+ *          load the root atomically and see a complete, consistent version for
+ *          as long as they hold it, without taking a lock, however many writes
+ *          follow. Nodes are reference counted and freed when the last version
+ *          that uses them is released. Threads cannot be kept in a tree whose
+ *          nodes are shared between versions, so the Inorder iterator keeps a
+ *          stack of the ancestors of its current node instead. Being a
+ *          template, this file is included by PersistentBST.h rather than
+ *          compiled on its own.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _PERSISTENTBST_CPP
+#define	_PERSISTENTBST_CPP
+
+#include <cstddef>          // definition of NULL
+#include <memory>           // for shared_ptr and its atomic operations
+#include <new>              // for bad_alloc
+#include <vector>           // for the iterator's ancestor stack
+
+#include "PersistentBST.h"
+
+using namespace std;
+
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::VersionNode::VersionNode(
+                                                 const Key& nodeKey,
+                                                 const Value& nodeValue,
+                                                 const NodePtr& left,
+                                                 const NodePtr& right) :
+  key(nodeKey), value(nodeValue), leftChildPtr(left), rightChildPtr(right),
+  height(1 + (heightOf(left) > heightOf(right) ? heightOf(left) :
+                                                 heightOf(right))),
+  count(1 + countOf(left) + countOf(right))
+{
+} // end constructor
+// end VersionNode
+
+
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::Inorder::Inorder(const NodePtr& aVersion) :
+                      version(aVersion)
+{
+} // end constructor
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::Inorder::Inorder(const Inorder& orig) :
+                      version(orig.version), path(orig.path)
+{
+} // end copy constructor
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::Inorder::~Inorder()
+{
+} // end destructor
+
+/** Assign an existing iterator's position to this object.
+ * @param rhs  The iterator with the values to be assigned.
+ * @pre None
+ * @post This object is a duplicate of rhs. rhs is unchanged
+ */
+template <class Key, class Value, class Compare>
+void PersistentBST<Key, Value, Compare>::Inorder::operator=(const Inorder& rhs)
+{
+    version = rhs.version;
+    path = rhs.path;
+} // end operator=(Inorder&)
+
+/** Obtain a reference to the value to which this iterator points.
+ * @pre This iterator points to a node that contains a data item.
+ * @post None
+ */
+template <class Key, class Value, class Compare>
+const Value& PersistentBST<Key, Value, Compare>::Inorder::operator*(void) const
+{
+    return path.back()->value;
+} // end operator*(void)
+
+/** Obtain a reference to the key of the node this iterator points to.
+ * @pre This iterator points to a node that contains a data item.
+ * @post None
+ */
+template <class Key, class Value, class Compare>
+const Key& PersistentBST<Key, Value, Compare>::Inorder::getKey(void) const
+{
+    return path.back()->key;
+} // end getKey(void)
+
+/** Move this iterator to the next inorder node in its version.
+ * @pre This iterator is not past the last inorder element.
+ * @post This iterator points to the inorder successor of its previous node, or
+ *       one step past end() if there was none.
+ * @return This iterator.
+ * @throw bad_alloc  If the ancestor stack cannot grow.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::Inorder
+PersistentBST<Key, Value, Compare>::Inorder::operator++(void)
+{
+    const VersionNode *curPtr = path.back();
+
+    if (curPtr->rightChildPtr)
+    {
+        // Find leftmost node of right branch
+        curPtr = curPtr->rightChildPtr.get();
+        path.push_back(curPtr);
+
+        while (curPtr->leftChildPtr)
+        {
+            curPtr = curPtr->leftChildPtr.get();
+            path.push_back(curPtr);
+        } // end while (curPtr->leftChildPtr)
+    }
+    else
+    {
+        // climb past ancestors whose right subtree is done
+        path.pop_back();
+
+        while (!path.empty() && path.back()->rightChildPtr.get() == curPtr)
+        {
+            curPtr = path.back();
+            path.pop_back();
+        } // end while (!path.empty() ...)
+    } // end if (curPtr->rightChildPtr)
+
+    return *this;
+} // end operator++(void)
+
+/** Move this iterator to the previous inorder node in its version.
+ * @pre This iterator is not already at the first inorder element.
+ * @post This iterator points to the inorder predecessor of its previous node.
+ * @return This iterator.
+ * @throw bad_alloc  If the ancestor stack cannot grow.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::Inorder
+PersistentBST<Key, Value, Compare>::Inorder::operator--(void)
+{
+    const VersionNode *curPtr = path.back();
+
+    if (curPtr->leftChildPtr)
+    {
+        // Find rightmost node of left branch
+        curPtr = curPtr->leftChildPtr.get();
+        path.push_back(curPtr);
+
+        while (curPtr->rightChildPtr)
+        {
+            curPtr = curPtr->rightChildPtr.get();
+            path.push_back(curPtr);
+        } // end while (curPtr->rightChildPtr)
+    }
+    else
+    {
+        // climb past ancestors whose left subtree is done
+        path.pop_back();
+
+        while (!path.empty() && path.back()->leftChildPtr.get() == curPtr)
+        {
+            curPtr = path.back();
+            path.pop_back();
+        } // end while (!path.empty() ...)
+    } // end if (curPtr->leftChildPtr)
+
+    return *this;
+} // end operator--(void)
+
+/** Compare this iterator for equality with another.
+ * @param rhs  The iterator with which to compare.
+ * @pre None.
+ * @post None.
+ * @return true if this iterator points to the same version and node as the
+ *         rhs iterator, false otherwise.
+ */
+template <class Key, class Value, class Compare>
+bool PersistentBST<Key, Value, Compare>::Inorder::operator==(
+                                             const Inorder& rhs) const
+{
+    return (version == rhs.version &&
+            (path.empty() ? NULL : path.back()) ==
+            (rhs.path.empty() ? NULL : rhs.path.back()));
+} // end operator==(Inorder&)
+
+/** Compare this iterator for inequality with another.
+ * @param rhs  The iterator with which to compare.
+ * @pre None.
+ * @post None.
+ * @return true if this iterator points to a different version or node than
+ *         the rhs iterator, false otherwise.
+ */
+template <class Key, class Value, class Compare>
+bool PersistentBST<Key, Value, Compare>::Inorder::operator!=(
+                                             const Inorder& rhs) const
+{
+    return !(*this == rhs);
+} // end operator!=(Inorder&)
+// end Inorder
+
+
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::PersistentBST()
+{
+} // end default constructor
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::PersistentBST(const PersistentBST& orig) :
+                                    root(atomic_load(&orig.root)),
+                                    compare(orig.compare)
+{
+} // end copy constructor
+
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>::~PersistentBST()
+{
+} // end destructor
+
+/** Determines whether the current version of this tree is empty.
+ * @pre None.
+ * @post None.
+ * @return true if the tree is empty; otherwise returns false.
+ */
+template <class Key, class Value, class Compare>
+bool PersistentBST<Key, Value, Compare>::isEmpty(void) const
+{
+    return !atomic_load(&root);
+} // end isEmpty()
+
+/** Counts the items in the current version of this tree.
+ * @pre None.
+ * @post None.
+ * @return The number of items in the tree.
+ */
+template <class Key, class Value, class Compare>
+int PersistentBST<Key, Value, Compare>::getLength(void) const
+{
+    return countOf(atomic_load(&root));
+} // end getLength()
+
+/** Publishes a new version of this tree with an item added.
+ * @param newKey  The search key of the item to be added to the tree.
+ * @param newValue  The value to be stored under newKey.
+ * @pre None.
+ * @post newKey is in its proper order in the current version. Versions
+ *       already held by readers are unchanged.
+ * @throw TreeException  If memory allocation fails; the current version is
+ *        unchanged.
+ */
+template <class Key, class Value, class Compare>
+void PersistentBST<Key, Value, Compare>::searchTreeInsert(const Key& newKey,
+                                                        const Value& newValue)
+                                        throw(TreeException)
+// Algorithm note: The new version is built from the version current when the
+// write began. If another writer publishes first, the exchange fails, reloads
+// the newer root into oldRoot, and the path is copied again from there.
+{
+    NodePtr oldRoot = atomic_load(&root);
+    NodePtr newRoot;
+
+    try
+    {
+        do
+        {
+            newRoot = insertNode(oldRoot, newKey, newValue);
+        } while (!atomic_compare_exchange_weak(&root, &oldRoot, newRoot));
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: searchTreeInsert cannot allocate memory");
+    } // end try
+} // end searchTreeInsert(Key&, Value&)
+
+/** Publishes a new version of this tree with an item removed.
+ * @param searchKey  Key of the item to locate and remove from this tree.
+ * @pre searchKey is the search key of the item to be deleted.
+ * @post If the item whose search key equals searchKey existed, it is not in
+ *       the current version. Versions already held by readers are unchanged.
+ * @throw TreeException  If searchKey is not found in the tree, or memory
+ *        allocation fails; the current version is unchanged.
+ */
+template <class Key, class Value, class Compare>
+void PersistentBST<Key, Value, Compare>::searchTreeDelete(const Key& searchKey)
+                                        throw(TreeException)
+{
+    NodePtr oldRoot = atomic_load(&root);
+    NodePtr newRoot;
+    bool    found;
+
+    try
+    {
+        do
+        {
+            found = false;
+            newRoot = removeNode(oldRoot, searchKey, found);
+
+            if (!found)
+            {
+                throw TreeException(
+                        "TreeException: delete failed");    // not found
+            } // end if (!found)
+        } while (!atomic_compare_exchange_weak(&root, &oldRoot, newRoot));
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: searchTreeDelete cannot allocate memory");
+    } // end try
+} // end searchTreeDelete(Key&)
+
+/** Retrieves an item with a given search key from the current version.
+ * @param searchKey  The search key of the item to be located. May be of any
+ *        type that Compare can order against Key.
+ * @param treeValue  A container for the value of the found item.
+ * @pre searchKey is the search key of the item to be retrieved.
+ * @post If the retrieval was successful, treeValue contains the value of the
+ *       retrieved item.
+ * @throw TreeException  If no such item exists.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+void PersistentBST<Key, Value, Compare>::searchTreeRetrive(
+                                            const SearchKey& searchKey,
+                                            Value& treeValue) const
+                                        throw(TreeException)
+{
+    NodePtr            version = atomic_load(&root);    // held while reading
+    const VersionNode *curPtr = version.get();
+
+    while (curPtr != NULL)
+    {
+        int order = keyOrder(compare, searchKey, curPtr->key);
+
+        if (order < 0)
+        {
+            curPtr = curPtr->leftChildPtr.get();
+        }
+        else if (order > 0)
+        {
+            curPtr = curPtr->rightChildPtr.get();
+        }
+        else
+        {
+            treeValue = curPtr->value;
+            return;
+        } // end if (order < 0)
+    } // end while (curPtr != NULL)
+
+    throw TreeException(
+            "TreeException: searchKey not found");
+} // end searchTreeRetrieve(SearchKey&, Value&)
+
+/** Makes the current version of rhs the current version of this tree.
+ * @param rhs  The tree whose current version is taken.
+ * @pre None.
+ * @post This tree shares the version of rhs that was current.
+ * @return This tree.
+ */
+template <class Key, class Value, class Compare>
+PersistentBST<Key, Value, Compare>&
+PersistentBST<Key, Value, Compare>::operator=(const PersistentBST& rhs)
+{
+    if (this != &rhs)
+    {
+        atomic_store(&root, atomic_load(&rhs.root));
+        compare = rhs.compare;
+    } // end if (this != &rhs)
+
+    return *this;
+} // end operator=(PersistentBST&)
+
+/** Returns an iterator for the inorder first element of the current version.
+ *  The iterator keeps that version alive and unchanged.
+ * @pre Tree is not empty.
+ * @post None.
+ * @return An iterator that can access the element of the tree with the lowest
+ *         key value.
+ * @throw TreeException  If the tree is empty.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::Inorder
+PersistentBST<Key, Value, Compare>::begin(void) const
+                                    throw(TreeException)
+{
+    Inorder            index(atomic_load(&root));
+    const VersionNode *curPtr = index.version.get();
+
+    if (curPtr == NULL)
+    {
+        throw TreeException(
+                "TreeException: tree empty, cannot get begin()");
+    } // end if (curPtr == NULL)
+
+    for (; curPtr != NULL; curPtr = curPtr->leftChildPtr.get())
+    {
+        index.path.push_back(curPtr);
+    } // end for (; curPtr != NULL; ...)
+
+    return index;
+} // end begin()
+
+/** Returns an iterator for the inorder last element of the current version.
+ *  The iterator keeps that version alive and unchanged.
+ * @pre Tree is not empty.
+ * @post None.
+ * @return An iterator that can access the element of the tree with the
+ *         highest key value.
+ * @throw TreeException  If the tree is empty.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::Inorder
+PersistentBST<Key, Value, Compare>::end(void) const
+                                    throw(TreeException)
+{
+    Inorder            index(atomic_load(&root));
+    const VersionNode *curPtr = index.version.get();
+
+    if (curPtr == NULL)
+    {
+        throw TreeException(
+                "TreeException: tree empty, cannot get end()");
+    } // end if (curPtr == NULL)
+
+    for (; curPtr != NULL; curPtr = curPtr->rightChildPtr.get())
+    {
+        index.path.push_back(curPtr);
+    } // end for (; curPtr != NULL; ...)
+
+    return index;
+} // end end()
+
+/** Makes a node from an item and two balanced subtrees whose heights differ by
+ *  at most two, rotating if they differ by two.
+ * @param nodeKey  The search key of the new node.
+ * @param nodeValue  The value of the new node.
+ * @param left  The left subtree, whose keys precede nodeKey.
+ * @param right  The right subtree, whose keys follow nodeKey.
+ * @pre The heights of left and right differ by at most two.
+ * @post None.
+ * @return The root of a balanced subtree holding the item, left and right.
+ * @throw bad_alloc  If a node cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::NodePtr
+PersistentBST<Key, Value, Compare>::balanceNode(const Key& nodeKey,
+                                                const Value& nodeValue,
+                                                const NodePtr& left,
+                                                const NodePtr& right)
+// Algorithm note: Nodes cannot be changed, so a rotation builds new nodes for
+// the two or three nodes that move and reuses the subtrees beneath them.
+{
+    const NodePtr *inner;       // grandchild on the heavy side, nearest item
+
+    if (heightOf(left) > heightOf(right) + 1)
+    {
+        inner = &left->rightChildPtr;
+
+        if (heightOf(left->leftChildPtr) >= heightOf(*inner))
+        {
+            // single rotation right
+            return make_shared<VersionNode>(left->key, left->value,
+                       left->leftChildPtr,
+                       make_shared<VersionNode>(nodeKey, nodeValue,
+                                                *inner, right));
+        } // end if (heightOf(left->leftChildPtr) >= heightOf(*inner))
+
+        // double rotation: inner grandchild becomes the root
+        return make_shared<VersionNode>((*inner)->key, (*inner)->value,
+                   make_shared<VersionNode>(left->key, left->value,
+                                            left->leftChildPtr,
+                                            (*inner)->leftChildPtr),
+                   make_shared<VersionNode>(nodeKey, nodeValue,
+                                            (*inner)->rightChildPtr, right));
+    }
+    else if (heightOf(right) > heightOf(left) + 1)
+    {
+        inner = &right->leftChildPtr;
+
+        if (heightOf(right->rightChildPtr) >= heightOf(*inner))
+        {
+            // single rotation left
+            return make_shared<VersionNode>(right->key, right->value,
+                       make_shared<VersionNode>(nodeKey, nodeValue,
+                                                left, *inner),
+                       right->rightChildPtr);
+        } // end if (heightOf(right->rightChildPtr) >= heightOf(*inner))
+
+        // double rotation: inner grandchild becomes the root
+        return make_shared<VersionNode>((*inner)->key, (*inner)->value,
+                   make_shared<VersionNode>(nodeKey, nodeValue,
+                                            left, (*inner)->leftChildPtr),
+                   make_shared<VersionNode>(right->key, right->value,
+                                            (*inner)->rightChildPtr,
+                                            right->rightChildPtr));
+    } // end if (heightOf(left) > heightOf(right) + 1)
+
+    return make_shared<VersionNode>(nodeKey, nodeValue, left, right);
+} // end balanceNode(Key&, Value&, NodePtr&, NodePtr&)
+
+/** Copies the path to the insertion position of an item.
+ * @param nodePtr  The root of the subtree in which to insert.
+ * @param newKey  The search key of the item to be inserted.
+ * @param newValue  The value of the item to be inserted.
+ * @pre None.
+ * @post nodePtr is unchanged.
+ * @return The root of a balanced copy of the subtree with the item added.
+ * @throw bad_alloc  If a node cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::NodePtr
+PersistentBST<Key, Value, Compare>::insertNode(const NodePtr& nodePtr,
+                                               const Key& newKey,
+                                               const Value& newValue) const
+// Algorithm note: Each level of the path is rebuilt as the recursion unwinds,
+// so the recursion is as deep as the tree is tall; the AVL rules keep that
+// below 1.44 * log2(n + 2) levels.
+{
+    if (!nodePtr)
+    {
+        return make_shared<VersionNode>(newKey, newValue, NodePtr(), NodePtr());
+    } // end if (!nodePtr)
+
+    if (compare(newKey, nodePtr->key))
+    {
+        return balanceNode(nodePtr->key, nodePtr->value,
+                           insertNode(nodePtr->leftChildPtr, newKey, newValue),
+                           nodePtr->rightChildPtr);
+    } // end if (compare(newKey, nodePtr->key))
+
+    // equal keys go to the right, as in ThreadedBST
+    return balanceNode(nodePtr->key, nodePtr->value, nodePtr->leftChildPtr,
+                       insertNode(nodePtr->rightChildPtr, newKey, newValue));
+} // end insertNode(NodePtr&, Key&, Value&)
+
+/** Copies the path to an item to be removed.
+ * @param nodePtr  The root of the subtree from which to remove.
+ * @param searchKey  The search key of the item to be removed.
+ * @param found  Set to true if the item was found.
+ * @pre found is false.
+ * @post nodePtr is unchanged.
+ * @return The root of a balanced copy of the subtree without the item, or
+ *         nodePtr itself if the item was not found.
+ * @throw bad_alloc  If a node cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::NodePtr
+PersistentBST<Key, Value, Compare>::removeNode(const NodePtr& nodePtr,
+                                               const Key& searchKey,
+                                               bool& found) const
+{
+    NodePtr subtree;
+    Key     replacementKey;         // for removing node with two children
+    Value   replacementValue;
+
+    if (!nodePtr)
+    {
+        return nodePtr;     // not found; nothing copied
+    }
+    else if (compare(searchKey, nodePtr->key))
+    {
+        subtree = removeNode(nodePtr->leftChildPtr, searchKey, found);
+        return (!found ? nodePtr :
+                balanceNode(nodePtr->key, nodePtr->value, subtree,
+                            nodePtr->rightChildPtr));
+    }
+    else if (compare(nodePtr->key, searchKey))
+    {
+        subtree = removeNode(nodePtr->rightChildPtr, searchKey, found);
+        return (!found ? nodePtr :
+                balanceNode(nodePtr->key, nodePtr->value,
+                            nodePtr->leftChildPtr, subtree));
+    } // end if (!nodePtr)
+
+    found = true;
+
+    if (!nodePtr->leftChildPtr)
+    {
+        return nodePtr->rightChildPtr;
+    }
+    else if (!nodePtr->rightChildPtr)
+    {
+        return nodePtr->leftChildPtr;
+    } // end if (!nodePtr->leftChildPtr)
+
+    // two children: the inorder successor takes the place of the item
+    subtree = removeLeftmost(nodePtr->rightChildPtr, replacementKey,
+                             replacementValue);
+    return balanceNode(replacementKey, replacementValue,
+                       nodePtr->leftChildPtr, subtree);
+} // end removeNode(NodePtr&, Key&, bool&)
+
+/** Copies the path to the leftmost item of a subtree, leaving it out.
+ * @param nodePtr  The root of the subtree; nodePtr is not NULL.
+ * @param treeKey  A container for the key of the leftmost item.
+ * @param treeValue  A container for the value of the leftmost item.
+ * @pre None.
+ * @post nodePtr is unchanged.
+ * @return The root of a balanced copy of the subtree without its leftmost
+ *         item.
+ * @throw bad_alloc  If a node cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+typename PersistentBST<Key, Value, Compare>::NodePtr
+PersistentBST<Key, Value, Compare>::removeLeftmost(const NodePtr& nodePtr,
+                                                   Key& treeKey,
+                                                   Value& treeValue)
+{
+    if (!nodePtr->leftChildPtr)
+    {
+        // found leftmost - get its item
+        treeKey = nodePtr->key;
+        treeValue = nodePtr->value;
+        return nodePtr->rightChildPtr;
+    } // end if (!nodePtr->leftChildPtr)
+
+    return balanceNode(nodePtr->key, nodePtr->value,
+                       removeLeftmost(nodePtr->leftChildPtr, treeKey,
+                                      treeValue),
+                       nodePtr->rightChildPtr);
+} // end removeLeftmost(NodePtr&, Key&, Value&)
+
+/** Retrieves the height of a subtree.
+ * @param nodePtr  The root of the subtree; may be NULL.
+ * @pre None.
+ * @post None.
+ * @return The height of the subtree, 0 if it is empty.
+ */
+template <class Key, class Value, class Compare>
+int PersistentBST<Key, Value, Compare>::heightOf(const NodePtr& nodePtr)
+{
+    return (nodePtr ? nodePtr->height : 0);
+} // end heightOf(NodePtr&)
+
+/** Retrieves the number of nodes in a subtree.
+ * @param nodePtr  The root of the subtree; may be NULL.
+ * @pre None.
+ * @post None.
+ * @return The number of nodes in the subtree, 0 if it is empty.
+ */
+template <class Key, class Value, class Compare>
+int PersistentBST<Key, Value, Compare>::countOf(const NodePtr& nodePtr)
+{
+    return (nodePtr ? nodePtr->count : 0);
+} // end countOf(NodePtr&)
+
+
+#endif	/* _PERSISTENTBST_CPP */
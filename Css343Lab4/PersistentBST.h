@@ -0,0 +1,305 @@
+/*
+ * @file    PersistentBST.h
+ * @brief   A balanced binary search tree whose versions are never changed once
+ *          published. A write copies the nodes on the path from the root to
+ *          the item it changes, shares every other node with the previous
+ *          version, and publishes the new root with one atomic store. Readers
+ *          load the root atomically and see a complete, consistent version for
+ *          as long as they hold it, without taking a lock, however many writes
+ *          follow. Nodes are reference counted and freed when the last version
+ *          that uses them is released. Threads cannot be kept in a tree whose
+ *          nodes are shared between versions, so the Inorder iterator keeps a
+ *          stack of the ancestors of its current node instead. Balance is kept
+ *          by the AVL rules, so a path copy touches O(log n) nodes. Requires
+ *          C++11 for shared_ptr and its atomic operations.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _PERSISTENTBST_H
+#define	_PERSISTENTBST_H
+
+#include <memory>
+#include <vector>
+#include "ThreadedBST.h"
+#include "TreeException.h"
+
+
+template <class Key, class Value, class Compare = KeyLess>
+class PersistentBST
+{
+private:
+
+    struct VersionNode;
+    typedef shared_ptr<const VersionNode> NodePtr;
+
+    /** An immutable tree node. Its children may be shared by many versions.
+     */
+    struct VersionNode
+    {
+        VersionNode(const Key& nodeKey, const Value& nodeValue,
+                    const NodePtr& left, const NodePtr& right);
+
+        Key     key;                // search key
+        Value   value;              // data portion
+        NodePtr leftChildPtr;       // pointer to left child
+        NodePtr rightChildPtr;      // pointer to right child
+        int     height;             // nodes on longest path down to a leaf
+        int     count;              // nodes in subtree rooted here
+    }; // end VersionNode
+
+public:
+
+    friend class Inorder;
+
+    class Inorder
+    {
+    public:
+
+        friend class PersistentBST;
+
+        Inorder(const NodePtr& aVersion);
+
+        Inorder(const Inorder& orig);
+
+        virtual ~Inorder();
+
+        /** Assign an existing iterator's position to this object.
+         * @param rhs  The iterator with the values to be assigned.
+         * @pre None
+         * @post This object is a duplicate of rhs. rhs is unchanged
+         */
+        void operator=(const Inorder& rhs);
+
+        /** Obtain a reference to the value to which this iterator points.
+         * @pre This iterator points to a node that contains a data item.
+         * @post None
+         */
+        const Value& operator*(void) const;
+
+        /** Obtain a reference to the key of the node this iterator points to.
+         * @pre This iterator points to a node that contains a data item.
+         * @post None
+         */
+        const Key& getKey(void) const;
+
+        /** Move this iterator to the next inorder node in its version.
+         * @pre This iterator is not past the last inorder element.
+         * @post This iterator points to the inorder successor of its previous
+         *       node, or one step past end() if there was none.
+         * @return This iterator.
+         * @throw bad_alloc  If the ancestor stack cannot grow.
+         */
+        Inorder operator++(void);
+
+        /** Move this iterator to the previous inorder node in its version.
+         * @pre This iterator is not already at the first inorder element.
+         * @post This iterator points to the inorder predecessor of its
+         *       previous node.
+         * @return This iterator.
+         * @throw bad_alloc  If the ancestor stack cannot grow.
+         */
+        Inorder operator--(void);
+
+        /** Compare this iterator for equality with another.
+         * @param rhs  The iterator with which to compare.
+         * @pre None.
+         * @post None.
+         * @return true if this iterator points to the same version and node
+         *         as the rhs iterator, false otherwise.
+         */
+        bool operator==(const Inorder& rhs) const;
+
+        /** Compare this iterator for inequality with another.
+         * @param rhs  The iterator with which to compare.
+         * @pre None.
+         * @post None.
+         * @return true if this iterator points to a different version or
+         *         node than the rhs iterator, false otherwise.
+         */
+        bool operator!=(const Inorder& rhs) const;
+
+    private:
+
+        NodePtr                    version; // root that keeps nodes alive
+        vector<const VersionNode*> path;    // root to current; empty at end
+
+    }; // end Inorder
+
+
+
+ // constructors and destructor:
+    PersistentBST();
+
+    /** Creates a snapshot of another tree. Only the root is copied, so this
+     *  takes constant time; the two trees share nodes until either changes.
+     * @param orig  The tree whose current version is taken.
+     * @pre None.
+     * @post This tree holds the version of orig that was current.
+     */
+    PersistentBST(const PersistentBST& orig);
+
+    virtual ~PersistentBST();
+
+    /** Determines whether the current version of this tree is empty.
+     * @pre None.
+     * @post None.
+     * @return true if the tree is empty; otherwise returns false.
+     */
+    bool isEmpty(void) const;
+
+    /** Counts the items in the current version of this tree.
+     * @pre None.
+     * @post None.
+     * @return The number of items in the tree.
+     */
+    int getLength(void) const;
+
+    /** Publishes a new version of this tree with an item added.
+     * @param newKey  The search key of the item to be added to the tree.
+     * @param newValue  The value to be stored under newKey.
+     * @pre None.
+     * @post newKey is in its proper order in the current version. Versions
+     *       already held by readers are unchanged.
+     * @throw TreeException  If memory allocation fails; the current version
+     *        is unchanged.
+     */
+    void searchTreeInsert(const Key& newKey, const Value& newValue)
+         throw(TreeException);
+
+    /** Publishes a new version of this tree with an item removed.
+     * @param searchKey  Key of the item to locate and remove from this tree.
+     * @pre searchKey is the search key of the item to be deleted.
+     * @post If the item whose search key equals searchKey existed, it is not
+     *       in the current version. Versions already held by readers are
+     *       unchanged.
+     * @throw TreeException  If searchKey is not found in the tree, or memory
+     *        allocation fails; the current version is unchanged.
+     */
+    void searchTreeDelete(const Key& searchKey)
+         throw(TreeException);
+
+    /** Retrieves an item with a given search key from the current version.
+     * @param searchKey  The search key of the item to be located. May be of
+     *        any type that Compare can order against Key.
+     * @param treeValue  A container for the value of the found item.
+     * @pre searchKey is the search key of the item to be retrieved.
+     * @post If the retrieval was successful, treeValue contains the value of
+     *       the retrieved item.
+     * @throw TreeException  If no such item exists.
+     */
+    template <class SearchKey>
+    void searchTreeRetrive(const SearchKey& searchKey,
+                           Value& treeValue) const
+         throw(TreeException);
+
+    /** Makes the current version of rhs the current version of this tree.
+     * @param rhs  The tree whose current version is taken.
+     * @pre None.
+     * @post This tree shares the version of rhs that was current.
+     * @return This tree.
+     */
+    PersistentBST& operator=(const PersistentBST& rhs);
+
+    /** Returns an iterator for the inorder first element of the current
+     *  version. The iterator keeps that version alive and unchanged.
+     * @pre Tree is not empty.
+     * @post None.
+     * @return An iterator that can access the element of the tree with the
+     *         lowest key value.
+     * @throw TreeException  If the tree is empty.
+     */
+    Inorder begin(void) const
+            throw(TreeException);
+
+    /** Returns an iterator for the inorder last element of the current
+     *  version. The iterator keeps that version alive and unchanged.
+     * @pre Tree is not empty.
+     * @post None.
+     * @return An iterator that can access the element of the tree with the
+     *         highest key value.
+     * @throw TreeException  If the tree is empty.
+     */
+    Inorder end(void) const
+            throw(TreeException);
+
+private:
+
+    NodePtr root;               // current version; accessed atomically
+    Compare compare;            // ordering of keys
+
+    /** Makes a node from an item and two balanced subtrees whose heights
+     *  differ by at most two, rotating if they differ by two.
+     * @param nodeKey  The search key of the new node.
+     * @param nodeValue  The value of the new node.
+     * @param left  The left subtree, whose keys precede nodeKey.
+     * @param right  The right subtree, whose keys follow nodeKey.
+     * @pre The heights of left and right differ by at most two.
+     * @post None.
+     * @return The root of a balanced subtree holding the item, left and
+     *         right.
+     * @throw bad_alloc  If a node cannot be allocated.
+     */
+    static NodePtr balanceNode(const Key& nodeKey, const Value& nodeValue,
+                               const NodePtr& left, const NodePtr& right);
+
+    /** Copies the path to the insertion position of an item.
+     * @param nodePtr  The root of the subtree in which to insert.
+     * @param newKey  The search key of the item to be inserted.
+     * @param newValue  The value of the item to be inserted.
+     * @pre None.
+     * @post nodePtr is unchanged.
+     * @return The root of a balanced copy of the subtree with the item added.
+     * @throw bad_alloc  If a node cannot be allocated.
+     */
+    NodePtr insertNode(const NodePtr& nodePtr, const Key& newKey,
+                       const Value& newValue) const;
+
+    /** Copies the path to an item to be removed.
+     * @param nodePtr  The root of the subtree from which to remove.
+     * @param searchKey  The search key of the item to be removed.
+     * @param found  Set to true if the item was found.
+     * @pre found is false.
+     * @post nodePtr is unchanged.
+     * @return The root of a balanced copy of the subtree without the item,
+     *         or nodePtr itself if the item was not found.
+     * @throw bad_alloc  If a node cannot be allocated.
+     */
+    NodePtr removeNode(const NodePtr& nodePtr, const Key& searchKey,
+                       bool& found) const;
+
+    /** Copies the path to the leftmost item of a subtree, leaving it out.
+     * @param nodePtr  The root of the subtree; nodePtr is not NULL.
+     * @param treeKey  A container for the key of the leftmost item.
+     * @param treeValue  A container for the value of the leftmost item.
+     * @pre None.
+     * @post nodePtr is unchanged.
+     * @return The root of a balanced copy of the subtree without its
+     *         leftmost item.
+     * @throw bad_alloc  If a node cannot be allocated.
+     */
+    static NodePtr removeLeftmost(const NodePtr& nodePtr, Key& treeKey,
+                                  Value& treeValue);
+
+    /** Retrieves the height of a subtree.
+     * @param nodePtr  The root of the subtree; may be NULL.
+     * @pre None.
+     * @post None.
+     * @return The height of the subtree, 0 if it is empty.
+     */
+    static int heightOf(const NodePtr& nodePtr);
+
+    /** Retrieves the number of nodes in a subtree.
+     * @param nodePtr  The root of the subtree; may be NULL.
+     * @pre None.
+     * @post None.
+     * @return The number of nodes in the subtree, 0 if it is empty.
+     */
+    static int countOf(const NodePtr& nodePtr);
+
+}; // end PersistentBST
+
+
+#include "PersistentBST.cpp"
+
+#endif	/* _PERSISTENTBST_H */
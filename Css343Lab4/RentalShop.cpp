@@ -9,6 +9,7 @@
  * @date    March 9, 2012
  */
 
+#include <utility>
 #include "RentalShop.h"
 
 
@@ -29,7 +30,7 @@ int RentalShop::getItemQty(void) const
 
 bool RentalShop::setItemQty(int stockSize)
 {
-    stock.setItemQty(stockSize);
+    return stock.setItemQty(stockSize);
 } // end setItemQty(int)
 
 int RentalShop::getMaxQty(void) const
@@ -47,11 +48,26 @@ bool RentalShop::addItem(const Merch *newItem)
     return stock.addItem(newItem);
 } // end addItem(Merch*)
 
+bool RentalShop::addItems(const vector<const Merch*>& newItems)
+{
+    return stock.addItems(newItems);
+} // end addItems(vector<Merch*>&)
+
+bool RentalShop::addItems(vector<Merch*>&& newItems)
+{
+    return stock.addItems(move(newItems));
+} // end addItems(vector<Merch*>&&)
+
 bool RentalShop::updateItem(const Merch *item)
 {
     return stock.updateItem(item);
 } // end updateItem(Merch*)
 
+bool RentalShop::replaceItem(Merch *item)
+{
+    return stock.replaceItem(item);
+} // end replaceItem(Merch*)
+
 bool RentalShop::removeItem(const Merch *item)
 {
     return stock.removeItem(item);
@@ -62,6 +78,16 @@ bool RentalShop::retrieveItem(Merch *& target) const
     return stock.retrieveItem(target);
 } // end findItem(Merch*&)
 
+bool RentalShop::borrowItem(const Merch *item)
+{
+    return stock.borrowItem(item);
+} // end borrowItem(Merch*)
+
+bool RentalShop::returnItem(const Merch *item)
+{
+    return stock.returnItem(item);
+} // end returnItem(Merch*)
+
 void RentalShop::showInventory(void) const
 {
     stock.displayInventory();
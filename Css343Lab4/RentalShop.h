@@ -61,6 +61,7 @@ public:
  *      Merchandise in the Inventory.
  * @post The ideal quantity of unique items for this Shop has been set to
  *       stockSize in its Inventory.
+ * @return true if the Inventory was resized; false, otherwise.
  */
     bool setItemQty(int stockSize);
 
@@ -99,8 +100,31 @@ public:
  */
     bool addItem(const Merch *newItem);
 
+/**---------------------- addItems() ------------------------------------------
+ * Adds a batch of Merchandise to the Inventory at once. Faster than adding the
+ * Merchandise one item at a time when stocking a new Shop.
+ * @param newItems  The Merchandise to add.
+ * @pre There is sufficent space in the Inventory for the Merchandise.
+ * @post Each piece of Merchandise exists in this Shop's Inventory.
+ * @return true if every piece of Merchandise was added; false, otherwise.
+ */
+    bool addItems(const vector<const Merch*>& newItems);
+
+/**---------------------- addItems() (Move) -----------------------------------
+ * Adds a batch of Merchandise to the Inventory at once, handing the
+ * Merchandise itself over rather than a copy of it.
+ * @param newItems  The Merchandise to add, allocated with new.
+ * @pre There is sufficent space in the Inventory for the Merchandise.
+ * @post Each piece of Merchandise exists in this Shop's Inventory, or has been
+ *       deleted. newItems is empty.
+ * @return true if every piece of Merchandise was added; false, otherwise.
+ */
+    bool addItems(vector<Merch*>&& newItems);
+
     bool updateItem(const Merch *item);
 
+    bool replaceItem(Merch *item);
+
 /**---------------------- removeItem() ----------------------------------------
  * Removes some Merchandise from the Inventory.
  * @param item  The Merchandise to remove.
@@ -123,6 +147,26 @@ public:
  */
     bool retrieveItem(Merch *& target) const;
 
+/**---------------------- borrowItem() ----------------------------------------
+ * Takes one copy of some Merchandise off hand in the Inventory.
+ * @param item  The Merchandise to borrow.
+ * @pre None.
+ * @post The available quantity of the item has been decreased by one in the
+ *       Inventory, if this returned true.
+ * @return true if the item was found and one was taken; false, otherwise.
+ */
+    bool borrowItem(const Merch *item);
+
+/**---------------------- returnItem() ----------------------------------------
+ * Puts one copy of some Merchandise back on hand in the Inventory.
+ * @param item  The Merchandise to return.
+ * @pre None.
+ * @post The available quantity of the item has been increased by one in the
+ *       Inventory, if this returned true.
+ * @return true if the item was found and one was put back; false, otherwise.
+ */
+    bool returnItem(const Merch *item);
+
 /**---------------------- showInventory() -------------------------------------
  * Displays the contents of the Inventory of this Shop. Relies on Merchandise
  * providing a display() method.
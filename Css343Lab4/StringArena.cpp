@@ -0,0 +1,111 @@
+/*
+ * @file    StringArena.cpp
+ * @brief   A store for the text of the catalog, such as titles and the names
+ *          of directors and actors. Each distinct text is copied once into a
+ *          large block of characters owned by the arena and is then referred
+ *          to through a TextRef, a pointer and a length, which costs nothing
+ *          to copy. Blocks are never moved or freed while the arena exists,
+ *          so a TextRef stays valid for the lifetime of its arena. The shared
+ *          arena lasts as long as the program. Interning text that is already
+ *          stored returns the existing TextRef. The arena is not safe to use
+ *          from several threads.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#include <new>
+#include "StringArena.h"
+
+
+StringArena::StringArena() : nextChar(NULL), charsLeft(0), bytes(0)
+{
+} // end Constructor
+
+StringArena::~StringArena()
+{
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        delete [] blocks[i];
+    } // end for (i < blocks.size())
+} // end Destructor
+
+TextRef StringArena::intern(const string& newText)
+{
+    TextRef  probe(newText);            // views newText only for the search
+    TextRef *stored;
+    TextRef  copy;
+
+    if (probe.empty())
+    {
+        return TextRef();
+    } // end if (probe.empty())
+
+    stored = texts.findMutable(probe);
+
+    if (stored != NULL)     // already stored; share the existing copy
+    {
+        return *stored;
+    } // end if (stored != NULL)
+
+    copy = store(probe);
+
+    try
+    {
+        texts.searchTreeInsert(copy, copy);
+    }
+    catch (TreeException e)
+    {
+        throw bad_alloc();  // the copy stays in its block, unused
+    } // end try
+
+    bytes += copy.length();
+    return copy;
+} // end intern(string&)
+
+int StringArena::getLength(void) const
+{
+    return texts.getLength();
+} // end getLength()
+
+size_t StringArena::getBytes(void) const
+{
+    return bytes;
+} // end getBytes()
+
+StringArena& StringArena::shared(void)
+{
+    static StringArena theArena;    // built on first use
+
+    return theArena;
+} // end shared()
+
+TextRef StringArena::store(const TextRef& newText)
+{
+    size_t length = newText.length();
+    char  *target;
+
+    blocks.reserve(blocks.size() + 1);  // so that push_back cannot throw
+
+    if (length > ARENABLOCKSIZE / 4)
+    {
+        // a long text gets a block of its own, so the current one is kept
+        target = new char[length];
+        blocks.push_back(target);
+    }
+    else
+    {
+        if (length > charsLeft)     // start a new block
+        {
+            nextChar = new char[ARENABLOCKSIZE];
+            charsLeft = ARENABLOCKSIZE;
+            blocks.push_back(nextChar);
+        } // end if (length > charsLeft)
+
+        target = nextChar;
+        nextChar += length;
+        charsLeft -= length;
+    } // end if (length > ARENABLOCKSIZE / 4)
+
+    memcpy(target, newText.data(), length);
+    return TextRef(target, length);
+} // end store(TextRef&)
@@ -0,0 +1,236 @@
+/*
+ * @file    StringArena.h
+ * @brief   A store for the text of the catalog, such as titles and the names
+ *          of directors and actors. Each distinct text is copied once into a
+ *          large block of characters owned by the arena and is then referred
+ *          to through a TextRef, a pointer and a length, which costs nothing
+ *          to copy. Blocks are never moved or freed while the arena exists,
+ *          so a TextRef stays valid for the lifetime of its arena. The shared
+ *          arena lasts as long as the program. Interning text that is already
+ *          stored returns the existing TextRef. The arena is not safe to use
+ *          from several threads.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _STRINGARENA_H
+#define	_STRINGARENA_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "AVLThreadedBST.h"
+
+using namespace std;
+
+const size_t ARENABLOCKSIZE = 4096;     // characters in each arena block
+const size_t TEXTHASHSEED = 2166136261u;    // FNV-1a offset basis
+const size_t TEXTHASHPRIME = 16777619u;     // FNV-1a prime
+
+
+/** A read-only view of text stored elsewhere, usually in a StringArena. It
+ *  does not own its characters and is not terminated by a null character.
+ */
+class TextRef
+{
+public:
+
+    TextRef() : text(NULL), textLength(0)
+    {
+    } // end Default Constructor
+
+    TextRef(const char *aText, size_t aLength) :
+        text(aText), textLength(aLength)
+    {
+    } // end Constructor
+
+    /** Views the characters of a string, which must outlive this view.
+     */
+    explicit TextRef(const string& aString) :
+        text(aString.data()), textLength(aString.length())
+    {
+    } // end Constructor (string)
+
+    const char* data(void) const
+    {
+        return text;
+    } // end data()
+
+    size_t length(void) const
+    {
+        return textLength;
+    } // end length()
+
+    bool empty(void) const
+    {
+        return textLength == 0;
+    } // end empty()
+
+    /** Copies the text into a string of its own.
+     */
+    string str(void) const
+    {
+        return string(text, textLength);
+    } // end str()
+
+    /** Views part of the text without copying it.
+     * @param pos  The position of the first character; at most length().
+     * @param count  The most characters to include.
+     * @return A view of at most count characters from pos.
+     */
+    TextRef substr(size_t pos, size_t count) const
+    {
+        return TextRef(text + pos, (count < textLength - pos ?
+                                    count : textLength - pos));
+    } // end substr(size_t, size_t)
+
+    /** Orders two texts character by character, as string::compare does.
+     */
+    int compare(const TextRef& rhs) const
+    {
+        size_t common = (textLength < rhs.textLength ?
+                         textLength : rhs.textLength);
+        int    result = (common == 0 ? 0 : memcmp(text, rhs.text, common));
+
+        if (result != 0)
+        {
+            return result;
+        } // end if (result != 0)
+
+        return (textLength < rhs.textLength ? -1 :
+                (textLength > rhs.textLength ? 1 : 0));
+    } // end compare(TextRef&)
+
+    /** Hashes the characters of the text by FNV-1a, so that equal texts
+     *  hash alike wherever they are stored.
+     * @param seed  The hash to continue from, for hashing several texts as
+     *        one.
+     */
+    size_t hash(size_t seed = TEXTHASHSEED) const
+    {
+        for (size_t i = 0; i < textLength; ++i)
+        {
+            seed = (seed ^ static_cast<unsigned char>(text[i])) *
+                   TEXTHASHPRIME;
+        } // end for (i < textLength)
+
+        return seed;
+    } // end hash(size_t)
+
+    bool operator<(const TextRef& rhs) const
+    {
+        return compare(rhs) < 0;
+    } // end operator<(TextRef&)
+
+    bool operator==(const TextRef& rhs) const
+    {
+        return compare(rhs) == 0;
+    } // end operator==(TextRef&)
+
+    bool operator!=(const TextRef& rhs) const
+    {
+        return compare(rhs) != 0;
+    } // end operator!=(TextRef&)
+
+private:
+
+    const char *text;           // first character; not owned
+    size_t      textLength;     // number of characters
+
+}; // end TextRef
+
+
+/** Writes the text of a TextRef to an output stream.
+ * @param output  The stream to write to.
+ * @param aText  The text to write.
+ * @return output.
+ */
+inline ostream& operator<<(ostream& output, const TextRef& aText)
+{
+    return output.write(aText.data(), aText.length());
+} // end operator<<(ostream&, TextRef&)
+
+
+class StringArena
+{
+public:
+
+/**---------------------- Constructor -----------------------------------------
+ * Creates an empty StringArena. No block is allocated until text is stored.
+ * @pre None.
+ * @post An empty StringArena exists.
+ */
+    StringArena();
+
+/**---------------------- Destructor ------------------------------------------
+ * Frees every block of this StringArena. Every TextRef it gave out becomes
+ * invalid.
+ * @pre None.
+ * @post The storage of this StringArena is returned to the heap.
+ */
+    virtual ~StringArena();
+
+/**---------------------- intern() --------------------------------------------
+ * Stores a text in this StringArena, unless it is already stored.
+ * @param newText  The text to store.
+ * @pre None.
+ * @post The text of newText is stored in this StringArena.
+ * @return A view of the stored copy, valid for the life of this arena; an
+ *         empty view if newText is empty.
+ * @throw bad_alloc  If a block cannot be allocated.
+ */
+    TextRef intern(const string& newText);
+
+/**---------------------- getLength() -----------------------------------------
+ * Counts the distinct texts stored in this StringArena.
+ * @pre None.
+ * @post None.
+ * @return The number of distinct texts stored.
+ */
+    int getLength(void) const;
+
+/**---------------------- getBytes() ------------------------------------------
+ * Counts the characters stored in this StringArena.
+ * @pre None.
+ * @post None.
+ * @return The total length of the distinct texts stored.
+ */
+    size_t getBytes(void) const;
+
+/**---------------------- shared() --------------------------------------------
+ * Retrieves the arena that holds the text of the catalog. It is created on
+ * first use and lasts until the program ends.
+ * @pre None.
+ * @post The shared arena exists.
+ * @return The shared arena.
+ */
+    static StringArena& shared(void);
+
+private:
+
+    // not copyable; every TextRef points into the blocks of one arena
+    StringArena(const StringArena& orig);
+    StringArena& operator=(const StringArena& rhs);
+
+/**---------------------- store() ---------------------------------------------
+ * Copies characters into the current block, starting a new one if they do
+ * not fit.
+ * @param newText  The characters to copy.
+ * @pre newText is not empty.
+ * @post The characters are stored in a block of this arena.
+ * @return A view of the stored characters.
+ * @throw bad_alloc  If a block cannot be allocated.
+ */
+    TextRef store(const TextRef& newText);
+
+    vector<char*> blocks;       // storage for text; never moved
+    char         *nextChar;     // first free character of the last block
+    size_t        charsLeft;    // free characters in the last block
+    size_t        bytes;        // characters of text stored
+    AVLThreadedBST<TextRef, TextRef> texts;     // each stored text, by itself
+
+}; // end class StringArena
+
+#endif	/* _STRINGARENA_H */
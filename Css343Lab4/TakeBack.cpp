@@ -57,44 +57,38 @@ Transaction* TakeBack::copy(void) const
     // copy each data member
     tempTrans->setMediaCode(getMediaCode());
     tempTrans->setCustID(getCustID());
-    tempTrans->setItem(getItem());
+    tempTrans->adoptItem(getItem());
 
     return tempTrans;
 } // end copy()
 
 bool TakeBack::process(MOVIEStore& target) const
 {
-    Merch *tempMerch = getItem();
+    const Merch *tempMerch = peekItem();  // borrowed, so nothing to delete
     Customer tempCust(getCustID());
 
-    if (!target.retrieveItem(tempMerch))    // tempMerch updated during check
-    {
-        return false;
-    } // end if (!target.findItem(tempMerch))
-
     target.retrieveCustomer(tempCust);      // get full Customer record
 
-    // ensure stock can be increased
-    if (!tempMerch->setOnHandQty(tempMerch->getOnHandQty() + 1) ||
-            !tempCust.isBorrowing(tempMerch))
+    if (tempMerch == NULL || !tempCust.isBorrowing(tempMerch))
     {
         return false;   // item is not being borrowed
-    } // end if (tempMerch->setOnHandQty(...) ...)
+    } // end if (tempMerch == NULL || ...)
+
+    // one atomic step on the stocked item; nothing is copied or replaced
+    if (!target.returnItem(tempMerch))
+    {
+        return false;   // item is not stocked, or none is out
+    } // end if (!target.returnItem(tempMerch))
 
-    // room in stock for item and Customer is renting it
-    target.updateItem(tempMerch);       // add one back to Inventory
     tempCust.newTransaction(this);      // add this Transaction to History
     target.updateCustomer(tempCust);    // update target's Customer List
 
-    delete tempMerch;
-    tempMerch = NULL;
-
     return true;
 } // end process(MOVIEStore&)
 
 void TakeBack::display(ostream& output) const
 {
-    Merch *tempMerch = getItem();
+    const Merch *tempMerch = peekItem();
 
     if (tempMerch != NULL)          // there is an item
     {
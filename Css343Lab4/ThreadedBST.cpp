@@ -16,30 +16,44 @@
  *          left thread, 2 = right thread, 3 = both threads. Since left thread
  *          and right thread are both powers of 2, binary arithmetic is used to
  *          make comparisons and set the threads indicator element of a node.
+ *          Being a template, this file is included by ThreadedBST.h rather
+ *          than compiled on its own.
  * @author  Brendan Sweeney, SID 1161836
  * @date    December 8, 2011
  */
 
+#ifndef _THREADEDBST_CPP
+#define	_THREADEDBST_CPP
+
 #include <cstddef>          // definition of NULL
+#include <exception>        // for exception_ptr
+#include <functional>       // for ref
 #include <new>              // for bad_alloc
+#include <system_error>     // for system_error
+#include <thread>           // for parallel traversal
+#include <utility>          // for pair and move
+#include <vector>           // for traversal and build stacks
 
 #include "ThreadedBST.h"
 
 using namespace std;
 
 
-ThreadedBST::Inorder::Inorder(const ThreadedBST *aTree,
-                                    ThreadedTreeNode *aNode) :
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::Inorder::Inorder(const ThreadedBST *aTree,
+                                                   TreeNode *aNode) :
                       container(aTree), cur(aNode)
 {
 } // end constructor
 
-ThreadedBST::Inorder::Inorder(const Inorder& orig) :
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::Inorder::Inorder(const Inorder& orig) :
                       container(orig.container), cur(orig.cur)
 {
 } // end copy constructor
 
-ThreadedBST::Inorder::~Inorder()
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::Inorder::~Inorder()
 {
     container = NULL;
     cur = NULL;
@@ -50,27 +64,41 @@ ThreadedBST::Inorder::~Inorder()
  * @pre None
  * @post This object is a duplicate of rhs. rhs is unchanged
  */
-void ThreadedBST::Inorder::operator=(const Inorder& rhs)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::Inorder::operator=(const Inorder& rhs)
 {
     container = rhs.container;
     cur = rhs.cur;
 } // end operator=(Inorder&)
 
-/** Obtain a reference to the item to which this iterator points.
+/** Obtain a reference to the value to which this iterator points.
  * @pre This iterator points to a node that contains a data item.
  * @post None
  */
-const TreeItemType& ThreadedBST::Inorder::operator*(void)
+template <class Key, class Value, class Compare>
+const Value& ThreadedBST<Key, Value, Compare>::Inorder::operator*(void) const
 {
-    return cur->item;
+    return cur->value;
 } // end operator*(void)
 
+/** Obtain a reference to the key of the node this iterator points to.
+ * @pre This iterator points to a node that contains a data item.
+ * @post None
+ */
+template <class Key, class Value, class Compare>
+const Key& ThreadedBST<Key, Value, Compare>::Inorder::getKey(void) const
+{
+    return cur->key;
+} // end getKey(void)
+
 /** Move this iterator to the next inorder node in its container.
  * @pre This iterator is not already at the last inorder element.
  * @post This iterator points to the inorder successor of its previous node.
  * @return This iterator.
  */
-ThreadedBST::Inorder ThreadedBST::Inorder::operator++(void)
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::Inorder::operator++(void)
 {
     if ((cur->threads & RIGHTTHREAD) == RIGHTTHREAD)
     {
@@ -97,7 +125,9 @@ ThreadedBST::Inorder ThreadedBST::Inorder::operator++(void)
  * @post This iterator points to the inorder predecessor of its previous node.
  * @return This iterator.
  */
-ThreadedBST::Inorder ThreadedBST::Inorder::operator--(void)
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::Inorder::operator--(void)
 {
     if ((cur->threads & LEFTTHREAD) == LEFTTHREAD)
     {
@@ -119,6 +149,7 @@ ThreadedBST::Inorder ThreadedBST::Inorder::operator--(void)
     return *this;
 } // end operator--(void)
 
+
 /** Compare the key value of this iterator's node item with another.
  * @param rhs  The iterator with which to compare.
  * @pre Both iterators reference the same container instance.
@@ -126,9 +157,11 @@ ThreadedBST::Inorder ThreadedBST::Inorder::operator--(void)
  * @return true if this iterator's node item has a lower key value than the
  *         item in the rhs node, false otherwise.
  */
-bool ThreadedBST::Inorder::operator<(const Inorder& rhs) const
+template <class Key, class Value, class Compare>
+bool ThreadedBST<Key, Value, Compare>::Inorder::operator<(
+                                             const Inorder& rhs) const
 {
-    return cur->item.getKey() < rhs.cur->item.getKey();
+    return container->compare(cur->key, rhs.cur->key);
 } // end operator<(Inorder&)
 
 /** Compare the key value of this iterator's node item with another.
@@ -138,9 +171,11 @@ bool ThreadedBST::Inorder::operator<(const Inorder& rhs) const
  * @return true if this iterator's node item has a higher key value than the
  *         item in the rhs node, false otherwise.
  */
-bool ThreadedBST::Inorder::operator>(const Inorder& rhs) const
+template <class Key, class Value, class Compare>
+bool ThreadedBST<Key, Value, Compare>::Inorder::operator>(
+                                             const Inorder& rhs) const
 {
-    return cur->item.getKey() > rhs.cur->item.getKey();
+    return container->compare(rhs.cur->key, cur->key);
 } // end operator>(Inorder&)
 
 /** Compare this iterator for equality with another.
@@ -150,7 +185,9 @@ bool ThreadedBST::Inorder::operator>(const Inorder& rhs) const
  * @return true if this iterator points to the same container and node as the
  *         rhs iterator, false otherwise.
  */
-bool ThreadedBST::Inorder::operator==(const Inorder& rhs) const
+template <class Key, class Value, class Compare>
+bool ThreadedBST<Key, Value, Compare>::Inorder::operator==(
+                                             const Inorder& rhs) const
 {
     return ((container == rhs.container) && (cur == rhs.cur));
 } // end operator==(Inorder&)
@@ -162,7 +199,9 @@ bool ThreadedBST::Inorder::operator==(const Inorder& rhs) const
  * @return true if this iterator points to a different container or node than
  *         the rhs iterator, false otherwise.
  */
-bool ThreadedBST::Inorder::operator!=(const Inorder& rhs) const
+template <class Key, class Value, class Compare>
+bool ThreadedBST<Key, Value, Compare>::Inorder::operator!=(
+                                             const Inorder& rhs) const
 {
     return !(*this == rhs);
 } // end operator!=(Inorder&)
@@ -170,17 +209,28 @@ bool ThreadedBST::Inorder::operator!=(const Inorder& rhs) const
 
 
 
-ThreadedBST::ThreadedBST() : root(NULL)
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::ThreadedBST() : root(NULL)
 {
 } // end default constructor
 
-ThreadedBST::ThreadedBST(const ThreadedBST& orig)
-             throw(TreeException)
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::ThreadedBST(const ThreadedBST& orig)
+             throw(TreeException) : compare(orig.compare), root(NULL)
 {
     copyTree(orig.root, root);
 } // end copy constructor
 
-ThreadedBST::~ThreadedBST()
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::ThreadedBST(ThreadedBST&& orig)
+             throw() : compare(orig.compare), root(orig.root)
+{
+    pool.swap(orig.pool);       // nodes stay in the slabs that hold them
+    orig.root = NULL;
+} // end move constructor
+
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>::~ThreadedBST()
 {
     destroyTree(root);
 } // end destructor
@@ -190,25 +240,71 @@ ThreadedBST::~ThreadedBST()
  * @post None.
  * @return true if the tree is empty; othersie returns false.
  */
-bool ThreadedBST::isEmpty() const
+template <class Key, class Value, class Compare>
+bool ThreadedBST<Key, Value, Compare>::isEmpty() const
 {
     return (root == NULL);
 } // end isEmpty()
 
 /** Inserts an item into a threaded binary search tree.
- * @param newItem  A value, passed by reference, to be added to the tree.
- * @pre The item to e inserted into the tree is newItem.
- * @post newItem is in its proper order in the tree. If newItem has an inorder
+ * @param newKey  The search key of the item to be added to the tree.
+ * @param newValue  The value to be stored under newKey.
+ * @pre The item to e inserted into the tree is newKey and newValue.
+ * @post newKey is in its proper order in the tree. If newKey has an inorder
  *       successor or inorder predecessor already in the tree, a thread pointer
- *       is set in newItem's node to point to the nodes that contain those
+ *       is set in newKey's node to point to the nodes that contain those
  *       items.
  * @throw TreeException  If memory allocations fails.
  */
-void ThreadedBST::searchTreeInsert(const TreeItemType& newItem)
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::searchTreeInsert(const Key& newKey,
+                                                        const Value& newValue)
+                                      throw(TreeException)
 {
-    insertItem(root, NULL, NULL, newItem);
-} // end searchTreeInsert(TreeItemType&)
+    TreeNode *newPtr;
+
+    try
+    {
+        newPtr = allocateNode(newKey, newValue, NULL, NULL);
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: searchTreeInsert cannot allocate memory");
+    } // end try
+
+    insertItem(root, newPtr);
+} // end searchTreeInsert(Key&, Value&)
+
+/** Inserts an item into a threaded binary search tree, moving the key and
+ *  value into the new node rather than copying them.
+ * @param newKey  The search key of the item to be added to the tree.
+ * @param newValue  The value to be stored under newKey.
+ * @pre The item to be inserted into the tree is newKey and newValue.
+ * @post newKey is in its proper order in the tree. newKey and newValue are
+ *       left in a valid but unspecified state, unless memory allocation fails,
+ *       in which case they are unchanged.
+ * @throw TreeException  If memory allocations fails.
+ */
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::searchTreeInsert(Key&& newKey,
+                                                        Value&& newValue)
+                                      throw(TreeException)
+{
+    TreeNode *newPtr;
+
+    try
+    {
+        newPtr = allocateNode(move(newKey), move(newValue), NULL, NULL);
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: searchTreeInsert cannot allocate memory");
+    } // end try
+
+    insertItem(root, newPtr);
+} // end searchTreeInsert(Key&&, Value&&)
 
 /** Deletes an item with a given search key from a threaded binary search tree.
  * @param searchKey  Key of the item to locate and remove from this tree.
@@ -217,28 +313,371 @@ void ThreadedBST::searchTreeInsert(const TreeItemType& newItem)
  *       item is deleted. Otherwise, the tree is unchanged.
  * @throw TreeException  If searchKey is not found in the tree.
  */
-void ThreadedBST::searchTreeDelete(KeyType searchKey)
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::searchTreeDelete(const Key& searchKey)
+                                      throw(TreeException)
 {
     deleteItem(root, searchKey);
-} // end searchTreeDelete(KeyType)
+} // end searchTreeDelete(Key&)
 
 /** Retrieves an item with a given search key from a threaded binary search
  *  tree.
- * @param searchKey  The search key of the item to be located.
- * @param treeItem  A container for the found item.
+ * @param searchKey  The search key of the item to be located. May be of any
+ *        type that Compare can order against Key.
+ * @param treeValue  A container for the value of the found item.
  * @pre searchKey is the search key of the item to be retrieved.
- * @post If the retrieval was successful, treeItem contains the retrieved item.
+ * @post If the retrieval was successful, treeValue contains the value of the
+ *       retrieved item.
  * @throw TreeException  If no such item exists.
  */
-void ThreadedBST::searchTreeRetrive(KeyType searchKey,
-                                    TreeItemType& treeItem) const
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+void ThreadedBST<Key, Value, Compare>::searchTreeRetrive(
+                                            const SearchKey& searchKey,
+                                            Value& treeValue) const
+                                      throw(TreeException)
 {
     // if retrieveItem throws a TreeException, it is ignored here and passed
     // on to the point in the code where searchTreeRetrieve was called
-    retrieveItem(root, searchKey, treeItem);
-} // end searchTreeRetrieve(KeyType, TreeItemType)
+    retrieveItem(root, searchKey, treeValue);
+} // end searchTreeRetrieve(SearchKey&, Value&)
+
+/** Retrieves an item with a given search key from a threaded binary search
+ *  tree, reporting a missing item by its result rather than by throwing.
+ *  Meant for lookups that often miss.
+ * @param searchKey  The search key of the item to be located. May be of any
+ *        type that Compare can order against Key.
+ * @param treeValue  A container for the value of the found item.
+ * @pre None.
+ * @post If the retrieval was successful, treeValue contains the value of the
+ *       retrieved item; otherwise, treeValue is unchanged.
+ * @return true if an item has searchKey; false, otherwise.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+bool ThreadedBST<Key, Value, Compare>::tryRetrieve(const SearchKey& searchKey,
+                                                   Value& treeValue) const
+{
+    TreeNode *nodePtr = locateNode(root, searchKey);
+
+    if (nodePtr == NULL)
+    {
+        return false;   // no such item; nothing thrown
+    } // end if (nodePtr == NULL)
+
+    treeValue = nodePtr->value;
+    return true;
+} // end tryRetrieve(SearchKey&, Value&)
+
+/** Locates the value of an item so that it can be changed in place. The key
+ *  cannot be reached this way, so the order of the tree is kept; to change a
+ *  key, delete the item and insert it again.
+ * @param searchKey  The search key of the item to be located. May be of any
+ *        type that Compare can order against Key.
+ * @pre None.
+ * @post None.
+ * @return A pointer to the value of the located item, or NULL if no item has
+ *         searchKey. The pointer is valid until the tree is next changed by an
+ *         insertion or deletion.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+Value* ThreadedBST<Key, Value, Compare>::findMutable(
+                                            const SearchKey& searchKey)
+{
+    TreeNode *nodePtr = locateNode(root, searchKey);
+
+    return (nodePtr == NULL ? NULL : &nodePtr->value);
+} // end findMutable(SearchKey&)
+
+/** Replaces the contents of a threaded binary search tree with the items of a
+ *  sorted range, building a balanced tree in linear time.
+ * @param first  Iterator to the first item of the range. Each item is a pair
+ *        whose first member is a Key and second member is a Value.
+ * @param last  Iterator just past the last item of the range.
+ * @pre The keys in [first, last) are in nondecreasing order under Compare.
+ * @post This tree holds exactly the items of the range, in the same order,
+ *       with every thread set. No node has subtrees whose heights differ by
+ *       more than one, so the tree is also a valid AVL tree.
+ * @throw TreeException  If the range is not sorted or memory allocation fails;
+ *        the tree is left unchanged.
+ */
+template <class Key, class Value, class Compare>
+template <class InputIterator>
+void ThreadedBST<Key, Value, Compare>::searchTreeBuild(InputIterator first,
+                                                       InputIterator last)
+                                      throw(TreeException)
+// Algorithm note: Nodes are allocated in inorder, so the pool lays them out
+// in the order a traversal visits them. The middle node of each index range
+// becomes the root of that range, its children are the middles of the two
+// halves, and an empty half means the pointer on that side is a thread to the
+// neighbouring index. A range of m nodes splits into halves of (m - 1) / 2
+// and m / 2 nodes, and a range of m nodes is as tall as m has binary digits,
+// so the right half is taller only when m is even and m / 2 is a power of 2.
+{
+    vector<TreeNode*>        nodes;     // new nodes in sorted order
+    vector<pair<int, int> >  ranges;    // index ranges not yet linked
+    TreeNode *nodePtr;
+    bool      sorted = true;
+    int       low, high, mid, half;
+
+    try
+    {
+        for (; first != last && sorted; ++first)
+        {
+            nodes.push_back(NULL);      // grow before allocating, so no leak
+            nodes.back() = allocateNode(first->first, first->second,
+                                        NULL, NULL);
+            sorted = (nodes.size() < 2 ||
+                      !compare(nodes.back()->key,
+                               nodes[nodes.size() - 2]->key));
+        } // end for (; first != last && sorted; ++first)
+
+        if (sorted && !nodes.empty())
+        {
+            ranges.push_back(make_pair(0, int(nodes.size()) - 1));
+        } // end if (sorted && !nodes.empty())
+
+        while (!ranges.empty())
+        {
+            low = ranges.back().first;
+            high = ranges.back().second;
+            ranges.pop_back();
+            mid = low + (high - low) / 2;
+            nodePtr = nodes[mid];
+
+            if (low < mid)
+            {
+                nodePtr->leftChildPtr = nodes[low + (mid - 1 - low) / 2];
+                nodePtr->threads -= LEFTTHREAD;
+                ranges.push_back(make_pair(low, mid - 1));
+            }
+            else
+            {
+                nodePtr->leftChildPtr = (mid > 0 ? nodes[mid - 1] : NULL);
+            } // end if (low < mid)
+
+            if (mid < high)
+            {
+                nodePtr->rightChildPtr = nodes[mid + 1 + (high - mid - 1) / 2];
+                nodePtr->threads -= RIGHTTHREAD;
+                ranges.push_back(make_pair(mid + 1, high));
+            }
+            else
+            {
+                nodePtr->rightChildPtr = (mid + 1 < int(nodes.size()) ?
+                                          nodes[mid + 1] : NULL);
+            } // end if (mid < high)
+
+            nodePtr->count = high - low + 1;
+            half = (high - low + 1) / 2;
+            nodePtr->balance = ((high - low) % 2 == 1 &&
+                                (half & (half - 1)) == 0 ? 1 : 0);
+        } // end while (!ranges.empty())
+    }
+    catch (bad_alloc e)
+    {
+        for (size_t i = 0; i < nodes.size() && nodes[i] != NULL; ++i)
+        {
+            deallocateNode(nodes[i]);
+        } // end for (size_t i = 0; ...)
+
+        throw TreeException(
+                "TreeException: searchTreeBuild cannot allocate memory");
+    } // end try
+
+    if (!sorted)
+    {
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            deallocateNode(nodes[i]);
+        } // end for (size_t i = 0; i < nodes.size(); ++i)
+
+        throw TreeException(
+                "TreeException: searchTreeBuild input not sorted");
+    } // end if (!sorted)
+
+    destroyTree(root);      // new tree is complete; release the old one
+    root = (nodes.empty() ? NULL : nodes[(nodes.size() - 1) / 2]);
+} // end searchTreeBuild(InputIterator, InputIterator)
+
+/** Locates the first item whose key is not less than a given search key.
+ * @param searchKey  The search key at which to start. May be of any type that
+ *        Compare can order against Key.
+ * @pre None.
+ * @post None.
+ * @return An iterator to the located item. If every key is less than
+ *         searchKey, the iterator is one step past end() and must not be
+ *         dereferenced.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::lowerBound(const SearchKey& searchKey) const
+{
+    TreeNode *curPtr = root;
+    TreeNode *boundPtr = NULL;      // lowest key found not below searchKey
+
+    while (curPtr != NULL)
+    {
+        if (compare(curPtr->key, searchKey))
+        {
+            // bound is to the right, if there is a right subtree
+            curPtr = ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD ?
+                      NULL : curPtr->rightChildPtr);
+        }
+        else
+        {
+            // curPtr qualifies; a lower one can only be to the left
+            boundPtr = curPtr;
+            curPtr = ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                      NULL : curPtr->leftChildPtr);
+        } // end if (compare(curPtr->key, searchKey))
+    } // end while (curPtr != NULL)
+
+    return Inorder(this, boundPtr);
+} // end lowerBound(SearchKey&)
+
+/** Locates the first item whose key is greater than a given search key.
+ * @param searchKey  The search key at which to start. May be of any type that
+ *        Compare can order against Key.
+ * @pre None.
+ * @post None.
+ * @return An iterator to the located item. If no key is greater than
+ *         searchKey, the iterator is one step past end() and must not be
+ *         dereferenced.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::upperBound(const SearchKey& searchKey) const
+{
+    TreeNode *curPtr = root;
+    TreeNode *boundPtr = NULL;      // lowest key found above searchKey
+
+    while (curPtr != NULL)
+    {
+        if (compare(searchKey, curPtr->key))
+        {
+            // curPtr qualifies; a lower one can only be to the left
+            boundPtr = curPtr;
+            curPtr = ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                      NULL : curPtr->leftChildPtr);
+        }
+        else
+        {
+            // bound is to the right, if there is a right subtree
+            curPtr = ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD ?
+                      NULL : curPtr->rightChildPtr);
+        } // end if (compare(searchKey, curPtr->key))
+    } // end while (curPtr != NULL)
+
+    return Inorder(this, boundPtr);
+} // end upperBound(SearchKey&)
+
+/** Locates every item whose key is equal to a given search key.
+ * @param searchKey  The search key to match. May be of any type that Compare
+ *        can order against Key.
+ * @pre None.
+ * @post None.
+ * @return The pair lowerBound(searchKey), upperBound(searchKey). Advancing
+ *         from the first iterator until it equals the second visits each
+ *         matching item; the two are equal if there is no match.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+pair<typename ThreadedBST<Key, Value, Compare>::Inorder,
+     typename ThreadedBST<Key, Value, Compare>::Inorder>
+ThreadedBST<Key, Value, Compare>::equalRange(const SearchKey& searchKey) const
+{
+    return make_pair(lowerBound(searchKey), upperBound(searchKey));
+} // end equalRange(SearchKey&)
+
+/** Counts the items in a threaded binary search tree.
+ * @pre None.
+ * @post None.
+ * @return The number of items in the tree.
+ */
+template <class Key, class Value, class Compare>
+int ThreadedBST<Key, Value, Compare>::getLength(void) const
+{
+    return (root == NULL ? 0 : root->count);
+} // end getLength()
+
+/** Locates the item at a given position in sorted order.
+ * @param index  The zero-based position of the item to locate.
+ * @pre 0 <= index < getLength().
+ * @post None.
+ * @return An iterator to the item that has index items before it.
+ * @throw TreeException  If index is out of range.
+ */
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::select(int index) const
+                                  throw(TreeException)
+{
+    TreeNode *curPtr = root;
+    int       leftSize;
+
+    if (index < 0 || index >= getLength())
+    {
+        throw TreeException(
+                "TreeException: select index out of range");
+    } // end if (index < 0 || index >= getLength())
+
+    for (;;)    // Assert: index is within the subtree of curPtr
+    {
+        leftSize = childCount(curPtr, LEFTTHREAD);
+
+        if (index < leftSize)
+        {
+            curPtr = curPtr->leftChildPtr;
+        }
+        else if (index > leftSize)
+        {
+            index -= leftSize + 1;      // skip left subtree and curPtr
+            curPtr = curPtr->rightChildPtr;
+        }
+        else
+        {
+            return Inorder(this, curPtr);
+        } // end if (index < leftSize)
+    } // end for (;;)
+} // end select(int)
+
+/** Counts the items whose keys are less than a given search key.
+ * @param searchKey  The search key to rank. May be of any type that Compare
+ *        can order against Key.
+ * @pre None.
+ * @post None.
+ * @return The position that lowerBound(searchKey) would have in sorted order,
+ *         from 0 up to getLength().
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+int ThreadedBST<Key, Value, Compare>::rank(const SearchKey& searchKey) const
+{
+    TreeNode *curPtr = root;
+    int       lessCount = 0;        // items known to be below searchKey
+
+    while (curPtr != NULL)
+    {
+        if (compare(curPtr->key, searchKey))
+        {
+            // curPtr and its left subtree are all below searchKey
+            lessCount += childCount(curPtr, LEFTTHREAD) + 1;
+            curPtr = ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD ?
+                      NULL : curPtr->rightChildPtr);
+        }
+        else
+        {
+            curPtr = ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                      NULL : curPtr->leftChildPtr);
+        } // end if (compare(curPtr->key, searchKey))
+    } // end while (curPtr != NULL)
+
+    return lessCount;
+} // end rank(SearchKey&)
 
 /** Traverses a threaded binary search tree in preorder, calling function
  *  visit() once for each item.
@@ -248,7 +687,8 @@ void ThreadedBST::searchTreeRetrive(KeyType searchKey,
  * @post visit's action occurred once for each item in the tree.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::preorderTraverse(FunctionType visit)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::preorderTraverse(FunctionType visit)
 {
     preorder(root, visit);
 } // end preorderTravers(FunctionType)
@@ -261,7 +701,8 @@ void ThreadedBST::preorderTraverse(FunctionType visit)
  * @post visit's action occurred once for each item in the tree.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::inorderTraverse(FunctionType visit)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::inorderTraverse(FunctionType visit)
 {
     inorder(root, visit);
 } // end inorderTraverse(FunctionType)
@@ -274,11 +715,206 @@ void ThreadedBST::inorderTraverse(FunctionType visit)
  * @post visit's action occurred once for each item in the tree.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::postorderTraverse(FunctionType visit)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::postorderTraverse(FunctionType visit)
 {
     postorder(root, visit);
 } // end postorderTraverse(FunctionType)
 
+/** Traverses a threaded binary search tree in preorder, calling a function
+ *  object once for each item. The call is made directly rather than through a
+ *  pointer, so it can be inlined, and the object can keep state from one item
+ *  to the next.
+ * @param visit  Any object callable as visit(const Key&, Value&).
+ * @pre None.
+ * @post visit has been called once for each item in the tree.
+ * @return visit, as it was after the last item, so that state it has gathered
+ *         can be read.
+ * @note visit() may change values, but not keys or the shape of the tree.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+Function ThreadedBST<Key, Value, Compare>::preorderTraverse(Function visit)
+{
+    preorder(root, visit);
+
+    return visit;
+} // end preorderTraverse(Function)
+
+/** Traverses a threaded binary search tree in sorted order, calling a
+ *  function object once for each item. The call is made directly rather than
+ *  through a pointer, so it can be inlined, and the object can keep state
+ *  from one item to the next.
+ * @param visit  Any object callable as visit(const Key&, Value&).
+ * @pre None.
+ * @post visit has been called once for each item in the tree.
+ * @return visit, as it was after the last item, so that state it has gathered
+ *         can be read.
+ * @note visit() may change values, but not keys or the shape of the tree.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+Function ThreadedBST<Key, Value, Compare>::inorderTraverse(Function visit)
+{
+    inorder(root, visit);
+
+    return visit;
+} // end inorderTraverse(Function)
+
+/** Traverses a threaded binary search tree in sorted order, calling a
+ *  function object once for each item without changing any of them.
+ * @param visit  Any object callable as visit(const Key&, const Value&).
+ * @pre None.
+ * @post visit has been called once for each item in the tree.
+ * @return visit, as it was after the last item, so that state it has gathered
+ *         can be read.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+Function ThreadedBST<Key, Value, Compare>::inorderTraverse(
+                                                Function visit) const
+{
+    ConstVisitor<Function> readOnly(visit);
+
+    inorder(root, readOnly);
+
+    return visit;
+} // end inorderTraverse(Function) const
+
+/** Traverses a threaded binary search tree in postorder, calling a function
+ *  object once for each item. The call is made directly rather than through a
+ *  pointer, so it can be inlined, and the object can keep state from one item
+ *  to the next.
+ * @param visit  Any object callable as visit(const Key&, Value&).
+ * @pre None.
+ * @post visit has been called once for each item in the tree.
+ * @return visit, as it was after the last item, so that state it has gathered
+ *         can be read.
+ * @note visit() may change values, but not keys or the shape of the tree.
+ * @throw bad_alloc  If the stack of pending ancestors cannot grow.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+Function ThreadedBST<Key, Value, Compare>::postorderTraverse(Function visit)
+{
+    postorder(root, visit);
+
+    return visit;
+} // end postorderTraverse(Function)
+
+/** Traverses a threaded binary search tree in sorted order on several threads
+ *  at once. The items are split by rank into as many consecutive ranges as
+ *  there are function objects, of sizes differing by at most one, and each
+ *  range is walked by its own thread. Reading the function objects in index
+ *  order afterwards is the same as one serial inorder walk.
+ * @param visitors  One object for each range, each callable as
+ *        visit(const Key&, const Value&). visitors[0] sees the lowest keys.
+ * @pre The tree is not changed by any thread until the call returns.
+ * @post Each object in visitors has been called once for each item in its
+ *       range, in sorted order.
+ * @throw  Whatever a function object throws, once every range is done. If
+ *         threads cannot be started, the ranges are walked on the calling
+ *         thread instead.
+ * @note Ranges of fewer than MINPARALLELITEMS items are all walked on the
+ *       calling thread.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+void ThreadedBST<Key, Value, Compare>::parallelInorderTraverse(
+                                        vector<Function>& visitors) const
+// Algorithm note: The subtree counts give the node of any rank in O(log n),
+// so the ranges are cut by rank rather than at the children of the root,
+// which could differ in size by a factor of two at every level. Each thread
+// then follows the threads from its first node, touching no shared state.
+{
+    int                   pieces = static_cast<int>(visitors.size());
+    int                   length = getLength();
+    vector<thread>        workers;
+    vector<exception_ptr> errors(pieces);
+
+    if (pieces == 0)
+    {
+        return;
+    } // end if (pieces == 0)
+
+    if (length / pieces < MINPARALLELITEMS)
+    {
+        pieces = 1;         // everything is walked on this thread below
+    } // end if (length / pieces < MINPARALLELITEMS)
+
+    workers.reserve(pieces - 1);
+
+    for (int i = 1; i < pieces; ++i)    // range 0 is kept for this thread
+    {
+        int first = static_cast<int>(static_cast<long long>(length) * i /
+                                     pieces);
+        int last = static_cast<int>(static_cast<long long>(length) *
+                                    (i + 1) / pieces);
+
+        try
+        {
+            workers.push_back(thread(
+                    &ThreadedBST::template inorderRange<Function>, this,
+                    first, last, ref(visitors[i]), ref(errors[i])));
+        }
+        catch (system_error e)
+        {
+            inorderRange(first, last, visitors[i], errors[i]);
+        } // end try
+    } // end for (i < pieces)
+
+    inorderRange(0, (pieces == 1 ? length : length / pieces), visitors[0],
+                 errors[0]);
+
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        workers[i].join();
+    } // end for (i < workers.size())
+
+    for (int i = 0; i < pieces; ++i)
+    {
+        if (errors[i])
+        {
+            rethrow_exception(errors[i]);
+        } // end if (errors[i])
+    } // end for (i < pieces)
+} // end parallelInorderTraverse(vector<Function>&)
+
+/** Traverses a threaded binary search tree in sorted order on several threads
+ *  at once and merges what the threads gather in key order. Each thread walks
+ *  one range with its own copy of visit. The copies are then merged from the
+ *  lowest range to the highest, so a visitor that appends to its output
+ *  produces the same result as a serial walk.
+ * @param visit  An object callable as visit(const Key&, const Value&), copied
+ *        once for each thread.
+ * @param threadCount  The number of ranges, and so of threads, to use.
+ * @param merge  An object callable as merge(Function& lower,
+ *        const Function& higher), which folds higher into lower.
+ * @pre The tree is not changed by any thread until the call returns.
+ * @post None.
+ * @return The copy of visit for the lowest range, with every higher range
+ *         merged into it in order.
+ * @throw  Whatever visit or merge throws.
+ */
+template <class Key, class Value, class Compare>
+template <class Function, class Merge>
+Function ThreadedBST<Key, Value, Compare>::parallelInorderTraverse(
+                                        const Function& visit,
+                                        int threadCount,
+                                        Merge merge) const
+{
+    vector<Function> parts((threadCount < 1 ? 1 : threadCount), visit);
+
+    parallelInorderTraverse(parts);
+
+    for (size_t i = 1; i < parts.size(); ++i)
+    {
+        merge(parts[0], parts[i]);      // lower ranges come first
+    } // end for (i < parts.size())
+
+    return parts[0];
+} // end parallelInorderTraverse(Function&, int, Merge)
+
 /** Copies the contents of rhs into this tree.
  * @param rhs  The right-hand tree to be copied.
  * @pre There is sufficient memory to allocate a copy of rhs.
@@ -286,18 +922,46 @@ void ThreadedBST::postorderTraverse(FunctionType visit)
  * @return The threaded binary search tree with newly-assigned values.
  * @throw TreeException  If memory allocation fails.
  */
-ThreadedBST& ThreadedBST::operator=(const ThreadedBST& rhs)
-                          throw(TreeException)
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>&
+ThreadedBST<Key, Value, Compare>::operator=(const ThreadedBST& rhs)
+                                  throw(TreeException)
 {
     if (this != &rhs)
     {
         destroyTree(root);          // deallocate left-hand side
+        compare = rhs.compare;
         copyTree(rhs.root, root);   // copy right-hand side
     } // end if (this != &rhs)
 
     return *this;
 } // end operator=(ThreadedBST&)
 
+/** Moves the contents of rhs into this tree.
+ * @param rhs  The right-hand tree whose nodes are taken.
+ * @pre None.
+ * @post This tree holds the items rhs held, without copying any of them; its
+ *       own items are deallocated and rhs is empty. Iterators into either
+ *       tree are invalidated.
+ * @return The threaded binary search tree with newly-assigned values.
+ */
+template <class Key, class Value, class Compare>
+ThreadedBST<Key, Value, Compare>&
+ThreadedBST<Key, Value, Compare>::operator=(ThreadedBST&& rhs)
+                                  throw()
+{
+    if (this != &rhs)
+    {
+        destroyTree(root);          // deallocate left-hand side
+        compare = rhs.compare;
+        root = rhs.root;            // take right-hand side with its storage
+        rhs.root = NULL;
+        pool.swap(rhs.pool);
+    } // end if (this != &rhs)
+
+    return *this;
+} // end operator=(ThreadedBST&&)
+
 /** Returns an iterator for the inorder first element of this tree.
  * @pre Tree is not empty.
  * @post None.
@@ -305,10 +969,12 @@ ThreadedBST& ThreadedBST::operator=(const ThreadedBST& rhs)
  *         key value.
  * @throw TreeException  If the tree is empty.
  */
-ThreadedBST::Inorder ThreadedBST::begin() const
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::begin() const
                                   throw(TreeException)
 {
-    ThreadedTreeNode *target = root;
+    TreeNode *target = root;
 
     if (isEmpty())
     {
@@ -331,10 +997,12 @@ ThreadedBST::Inorder ThreadedBST::begin() const
  *         key value.
  * @throw TreeException  If the tree is empty.
  */
-ThreadedBST::Inorder ThreadedBST::end() const
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::Inorder
+ThreadedBST<Key, Value, Compare>::end() const
                                   throw(TreeException)
 {
-    ThreadedTreeNode *target = root;
+    TreeNode *target = root;
 
     if (isEmpty())
     {
@@ -350,72 +1018,67 @@ ThreadedBST::Inorder ThreadedBST::end() const
     return Inorder(this, target);
 } // end end()
 
-/** Recursively inserts an item into a threaded binary search tree.
- * @param treePtr  Pointer to the node to start a check for insertion.
- * @param predecessor  Thread pointer to the inorder predecessor of the
- *        calling node's leftmost right descendant; NULL if not yet found.
- * @param successor  Thread pointer to the inorder successor of the calling
- *        node's rightmost left descendant; NULL if not yet found.
- * @param newItem  The item to be inserted into this tree.
- * @pre treePtr points to a threaded binary search tree, newItem is the item to
- *      be inserted. If tree is empty or contains only root, predecessor and
- *      successor must both be NULL.
- * @post newItem is in its proper order in the tree. If newItem has an inorder
- *       successor or inorder predecessor already in the tree, a thread pointer
- *       is set in newItem's node to point to the nodes that contain those
+/** Links a new node into a threaded binary search tree without recursion.
+ *  Both forms of searchTreeInsert() allocate the node and then call this, so
+ *  a subclass that keeps the tree in some other shape overrides this alone.
+ * @param treePtr  Pointer to the root of the tree in which to insert.
+ * @param newPtr  The node to be inserted, made by allocateNode().
+ * @pre treePtr points to a threaded binary search tree; newPtr is not linked
+ *      into any tree.
+ * @post The key of newPtr is in its proper order in the tree. If it has an
+ *       inorder successor or inorder predecessor already in the tree, a thread
+ *       pointer is set in newPtr to point to the nodes that contain those
  *       items.
- * @throw TreeException  If memory allocations fails.
  */
-void ThreadedBST::insertItem(ThreadedTreeNode *& treePtr,
-                             ThreadedTreeNode *predecessor,
-                             ThreadedTreeNode *successor,
-                       const TreeItemType& newItem)
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::insertItem(TreeNode *& treePtr,
+                                                  TreeNode *newPtr)
 {
-    if (treePtr == NULL)
-    { // position of insertion found; insert as leaf
-        // create a new node
-        try
-        {
-            treePtr = new ThreadedTreeNode(newItem, predecessor, successor);
-        }
-        catch (bad_alloc e)
-        {
-            throw TreeException(
-                    "TreeException: insertItem cannot allocate memory");
-        } // end try
-    }
-    // else search for the insertion position
-    else if (newItem.getKey() < treePtr->item.getKey())
-    {
-        if ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-        {
-            // Assert: treePtr->leftChildPtr == precedessor
-            treePtr->leftChildPtr = NULL;           // set for base case
-            treePtr->threads -= LEFTTHREAD;         // left pointer now child
-        } // end if ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD)
+    TreeNode *curPtr = treePtr;
 
-        // search the left subtree, keeping predecessor thread and setting
-        // successor thread to current node
-        insertItem(treePtr->leftChildPtr, predecessor, treePtr, newItem);
-    }
-    else
-    {
-        if ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
-        {
-            // Assert: treePtr->rightChildPtr == successor
-            treePtr->rightChildPtr = NULL;          // set for base case
-            treePtr->threads -= RIGHTTHREAD;        // right pointer now child
-        } // end if ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+    if (curPtr == NULL)
+    { // empty tree; insert as root
+        treePtr = newPtr;
+        return;
+    } // end if (curPtr == NULL)
 
-        // search the right subtree, keeping successor thread and setting
-        // predecessor thread to current node
-        insertItem(treePtr->rightChildPtr, treePtr, successor, newItem);
-    } // end if (treePtr == NULL)
-} // end insertItem(ThreadedTreeNode*&, ...)
+    for (;;)    // search for the insertion position
+    {
+        ++curPtr->count;    // new node joins the subtree of curPtr
 
-/** Recursively deletes an item from a threaded binary search tree.
- * @param treePtr  Pointer to the node to start a check for deletion.
+        if (compare(newPtr->key, curPtr->key))
+        {
+            if ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD)
+            {
+                // position of insertion found; the new leaf keeps the
+                // predecessor thread and threads back to curPtr
+                setChildPtrs(newPtr, curPtr->leftChildPtr, curPtr);
+                curPtr->leftChildPtr = newPtr;
+                curPtr->threads -= LEFTTHREAD;  // left pointer now child
+                return;
+            } // end if ((curPtr->threads & LEFTTHREAD) == LEFTTHREAD)
+
+            curPtr = curPtr->leftChildPtr;
+        }
+        else
+        {
+            if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+            {
+                // position of insertion found; the new leaf keeps the
+                // successor thread and threads back to curPtr
+                setChildPtrs(newPtr, curPtr, curPtr->rightChildPtr);
+                curPtr->rightChildPtr = newPtr;
+                curPtr->threads -= RIGHTTHREAD; // right pointer now child
+                return;
+            } // end if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+
+            curPtr = curPtr->rightChildPtr;
+        } // end if (compare(newPtr->key, curPtr->key))
+    } // end for (;;)
+} // end insertItem(TreeNode*&, TreeNode*)
+
+/** Deletes an item from a threaded binary search tree without recursion.
+ * @param treePtr  Pointer to the root of the tree from which to delete.
  * @parm searchKey  Search key of the item to be deleted from this tree.
  * @pre treePtr points to a binary search tree, searchKey is the search key of
  *      the item to be deleted.
@@ -423,32 +1086,55 @@ void ThreadedBST::insertItem(ThreadedTreeNode *& treePtr,
  *       item is deleted. Otherwise, the tree is unchanged.
  * @throw TreeException  If searchKey is not found in the tree.
  */
-void ThreadedBST::deleteItem(ThreadedTreeNode *& treePtr, KeyType searchKey)
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::deleteItem(TreeNode *& treePtr,
+                                                  const Key& searchKey)
+                                      throw(TreeException)
 // Calls: deleteNodeItem.
 {
-    if (treePtr == NULL)
-    {
-        throw TreeException(
-                "TreeException: delete failed");    // empty tree
-    }
-    else if (searchKey == treePtr->item.getKey())
-    {
-        // item is in the root of some subtree
-        deleteNodeItem(treePtr);    // delete the item
-    }
-    // else search for the item
-    else if (searchKey < treePtr->item.getKey())
-    {
-        // search the left subtree
-        deleteItem(treePtr->leftChildPtr, searchKey);
-    }
-    else
+    TreeNode **linkPtr = &treePtr;  // link that holds current node
+
+    while (*linkPtr != NULL)
     {
-        // search the right subtree
-        deleteItem(treePtr->rightChildPtr, searchKey);
-    } // end if (treePtr == NULL)
-} // end deleteItem(ThreadedTreeNode*&, KeyType)
+        int order = keyOrder(compare, searchKey, (*linkPtr)->key);
+
+        if (order < 0)
+        {
+            if (((*linkPtr)->threads & LEFTTHREAD) == LEFTTHREAD)
+            {
+                break;      // no left subtree to search
+            } // end if (((*linkPtr)->threads & LEFTTHREAD) == LEFTTHREAD)
+
+            linkPtr = &(*linkPtr)->leftChildPtr;
+        }
+        else if (order > 0)
+        {
+            if (((*linkPtr)->threads & RIGHTTHREAD) == RIGHTTHREAD)
+            {
+                break;      // no right subtree to search
+            } // end if (((*linkPtr)->threads & RIGHTTHREAD) == RIGHTTHREAD)
+
+            linkPtr = &(*linkPtr)->rightChildPtr;
+        }
+        else
+        {
+            // item is in the root of some subtree; every subtree on the path
+            // to it loses one node
+            for (TreeNode *curPtr = treePtr; curPtr != *linkPtr;
+                 curPtr = (compare(searchKey, curPtr->key) ?
+                           curPtr->leftChildPtr : curPtr->rightChildPtr))
+            {
+                --curPtr->count;
+            } // end for (TreeNode *curPtr = treePtr; ...)
+
+            deleteNodeItem(*linkPtr);   // delete the item
+            return;
+        } // end if (order < 0)
+    } // end while (*linkPtr != NULL)
+
+    throw TreeException(
+            "TreeException: delete failed");    // searchKey not found
+} // end deleteItem(TreeNode*&, Key&)
 
 /** Deletes the item in the root of a given tree.
  * @param nodePtr  Pointer to the node to be deleted.
@@ -456,7 +1142,8 @@ void ThreadedBST::deleteItem(ThreadedTreeNode *& treePtr, KeyType searchKey)
  *      nodePtr !- NULL.
  * @post The item in the root of the given tree is deleted.
  */
-void ThreadedBST::deleteNodeItem(ThreadedTreeNode *& nodePtr)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::deleteNodeItem(TreeNode *& nodePtr)
 // Algorithm note: There are four cases to consider:
 //   1. The root is a leaf (threads == BOTHTHREAD).
 //   2. The root has no left child (threads == LEFTTHREAD).
@@ -464,8 +1151,9 @@ void ThreadedBST::deleteNodeItem(ThreadedTreeNode *& nodePtr)
 //   4. The root has two children (threads == NOTHREAD).
 // Calls: processLeftmost.
 {
-    ThreadedTreeNode *delPtr = nodePtr;
-    TreeItemType      replacementItem;      // for deleting node with one child
+    TreeNode *delPtr = nodePtr;
+    Key       replacementKey;       // for deleting node with two children
+    Value     replacementValue;
 
     // test for a leaf
     if (nodePtr->threads == BOTHTHREAD)
@@ -483,176 +1171,384 @@ void ThreadedBST::deleteNodeItem(ThreadedTreeNode *& nodePtr)
             // nodePtr is right child - pass successor thread to parent
             nodePtr->leftChildPtr->threads += RIGHTTHREAD;
             nodePtr = nodePtr->rightChildPtr;
+        }
+        else
+        {
+            // nodePtr is the only node in the tree
+            nodePtr = NULL;
         } // end if (nodePtr->rightChildPtr != NULL ...)
 
-        delPtr->leftChildPtr = NULL;
-        delPtr->rightChildPtr = NULL;
-        delete delPtr;
+        deallocateNode(delPtr);
     } // end if leaf
     // test for no left child
     else if (nodePtr->threads == LEFTTHREAD)
     {
         passPredecessor(nodePtr->rightChildPtr, nodePtr->leftChildPtr);
         nodePtr = nodePtr->rightChildPtr;
-        delPtr->leftChildPtr = NULL;
-        delPtr->rightChildPtr = NULL;
-        delete delPtr;
+        deallocateNode(delPtr);
     } // end if no left child
     // test for no right child
     else if (nodePtr->threads == RIGHTTHREAD)
     {
         passSuccessor(nodePtr->leftChildPtr, nodePtr->rightChildPtr);
         nodePtr = nodePtr->leftChildPtr;
-        delPtr->leftChildPtr = NULL;
-        delPtr->rightChildPtr = NULL;
-        delete delPtr;
+        deallocateNode(delPtr);
     } // end if no right child
     // there are two children:
     // retrieve and delete the inorder successor
     else
     {
-        processLeftmost(nodePtr->rightChildPtr, replacementItem);
-        nodePtr->item = replacementItem;
+        --nodePtr->count;           // the successor's node goes instead
+        processLeftmost(nodePtr->rightChildPtr, replacementKey,
+                        replacementValue);
+        nodePtr->key = replacementKey;
+        nodePtr->value = replacementValue;
     } // end if two children
-} // end deleteNodeItem(ThreadedTreeNode*&)
+} // end deleteNodeItem(TreeNode*&)
 
 /** Retrieves and deletes the leftmost descendant of a given node.
  * @param nodePtr  Pointer to the node to start processing.
- * @param treeItem  A container for the item in the node to be delete.
+ * @param treeKey  A container for the key in the node to be delete.
+ * @param treeValue  A container for the value in the node to be delete.
  * @pre nodePtr points to a node in a threaded binary search tree;
  *      nodePtr != NULL.
- * @post treeItem contains the item in the leftmost descendant of the node to
- *       which nodePtr points. The leftmost descendant of nodePtr is deleted.
+ * @post treeKey and treeValue contain the item in the leftmost descendant of
+ *       the node to which nodePtr points. The leftmost descendant of nodePtr
+ *       is deleted.
  */
-void ThreadedBST::processLeftmost(ThreadedTreeNode *& nodePtr,
-                                  TreeItemType& treeItem)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::processLeftmost(TreeNode *& nodePtr,
+                                                       Key& treeKey,
+                                                       Value& treeValue)
 {
-    if ((nodePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-    {
-        // found leftmost - get its item
-        treeItem = nodePtr->item;
-        deleteNodeItem(nodePtr);
-    }
-    else
-    {
-        processLeftmost(nodePtr->leftChildPtr, treeItem);
-    } // end if ((nodePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-} // end processLeftmost(ThreadedTreeNode*&, TreeItemType&)
+    TreeNode **linkPtr = &nodePtr;  // link that holds current node
 
-/** Recursively retrieves an item from a threaded binary search tree.
+    while (((*linkPtr)->threads & LEFTTHREAD) != LEFTTHREAD)
+    {
+        --(*linkPtr)->count;        // leftmost is in this subtree
+        linkPtr = &(*linkPtr)->leftChildPtr;
+    } // end while (((*linkPtr)->threads & LEFTTHREAD) != LEFTTHREAD)
+
+    // found leftmost - get its item
+    // Assert: leftmost has no left child, so deleteNodeItem will not return
+    treeKey = (*linkPtr)->key;
+    treeValue = (*linkPtr)->value;
+    deleteNodeItem(*linkPtr);
+} // end processLeftmost(TreeNode*&, Key&, Value&)
+
+/** Retrieves an item from a threaded binary search tree without recursion.
  * @param treePtr  Pointer to the node at which to start searching.
  * @param searchKey  Search key of the item to be retrieved.
- * @param treeItem  A container for the located item.
- * @pre treePtr points to a binary search tree, treeItem is the search key of
+ * @param treeValue  A container for the value of the located item.
+ * @pre treePtr points to a binary search tree, searchKey is the search key of
  *      the item to be retrieved.
- * @post If the retrieval was successful, treeItem contains the retrieved item.
+ * @post If the retrieval was successful, treeValue contains the value of the
+ *       retrieved item.
  * @throw TreeException  If no such item exists.
  */
-void ThreadedBST::retrieveItem(ThreadedTreeNode *treePtr,
-                               KeyType searchKey,
-                               TreeItemType& treeItem) const
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+void ThreadedBST<Key, Value, Compare>::retrieveItem(TreeNode *treePtr,
+                                                    const SearchKey& searchKey,
+                                                    Value& treeValue) const
+                                      throw(TreeException)
 {
+    treePtr = locateNode(treePtr, searchKey);
+
     if (treePtr == NULL)
     {
         throw TreeException(
                 "TreeException: searchKey not found");
-    }
-    else if (searchKey == treePtr->item.getKey())
-    {
-        // item is in the root of some subtree
-        treeItem = treePtr->item;
-    }
-    else if (searchKey < treePtr->item.getKey())
-    {
-        // search the left subtree
-        retrieveItem(treePtr->leftChildPtr, searchKey, treeItem);
-    }
-    else
-    {
-        // search the right subtree
-        retrieveItem(treePtr->rightChildPtr, searchKey, treeItem);
     } // end if (treePtr == NULL)
-} // end retrieveItem(ThreadedTreeNode*, KeyType, TreeItemType&)
+
+    treeValue = treePtr->value;
+} // end retrieveItem(TreeNode*, SearchKey&, Value&)
+
+/** Finds the node of an item without recursion.
+ * @param treePtr  Pointer to the node at which to start searching.
+ * @param searchKey  Search key of the item to be found.
+ * @pre treePtr points to a binary search tree.
+ * @post None.
+ * @return The node whose key is equal to searchKey, or NULL if there is none.
+ */
+template <class Key, class Value, class Compare>
+template <class SearchKey>
+typename ThreadedBST<Key, Value, Compare>::TreeNode*
+ThreadedBST<Key, Value, Compare>::locateNode(TreeNode *treePtr,
+                                             const SearchKey& searchKey) const
+{
+    while (treePtr != NULL)
+    {
+        int order = keyOrder(compare, searchKey, treePtr->key);
+
+        if (order < 0)
+        {
+            // search the left subtree, if there is one
+            treePtr = ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                       NULL : treePtr->leftChildPtr);
+        }
+        else if (order > 0)
+        {
+            // search the right subtree, if there is one
+            treePtr = ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD ?
+                       NULL : treePtr->rightChildPtr);
+        }
+        else
+        {
+            return treePtr;     // item is in the root of some subtree
+        } // end if (order < 0)
+    } // end while (treePtr != NULL)
+
+    return NULL;
+} // end locateNode(TreeNode*, SearchKey&)
 
 /** Copies the tree rooted at treePtr into a tree rooted at newTreePtr.
  * @param treePtr  The root of the tree to be copied.
  * @param newTreePtr  A container for the root of a copy of treePtr.
  * @pre There is sufficient memory to allocate a new tree.
  * @post newTreePtr points to the root of a structural copy of the tree whose
- *       root is pointed to by treePtr.
+ *       root is pointed to by treePtr, including thread flags, balances and
+ *       subtree counts.
  * @throw TreeException  If a copy of the tree cannot be allocated.
  */
-void ThreadedBST::copyTree(ThreadedTreeNode *treePtr,
-                           ThreadedTreeNode *& newTreePtr)
-                  throw(TreeException)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::copyTree(TreeNode *treePtr,
+                                                TreeNode *& newTreePtr)
+                                      throw(TreeException)
+// Algorithm note: The original is walked in preorder by following its right
+// threads back up to the next unvisited right subtree. Each node is copied as
+// a new leaf under the copy of its parent, which threads the copy as it grows,
+// so the same thread steps can be taken in both trees at once. No stack or
+// recursion is needed.
 {
-    // preorder traversal
-    if (treePtr != NULL)
+    TreeNode *curPtr = treePtr;     // current node of original
+    TreeNode *newPtr;               // copy of curPtr
+
+    newTreePtr = NULL;                      // copy empty tree
+
+    if (curPtr == NULL)
     {
-        int thread = treePtr->threads;
-        // copy node
-        try
-        {
-            insertItem(newTreePtr, NULL, NULL, treePtr->item);
+        return;
+    } // end if (curPtr == NULL)
+
+    try
+    {
+        newTreePtr = allocateNode(curPtr->key, curPtr->value, NULL, NULL);
+        newPtr = newTreePtr;
+        newPtr->balance = curPtr->balance;
+        newPtr->count = curPtr->count;
 
-            if ((thread & LEFTTHREAD) != LEFTTHREAD)
+        for (;;)
+        {
+            if ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
             {
                 // continue down left branch, if not a thread
-                copyTree(treePtr->leftChildPtr, newTreePtr);
-            } // end if ((thread & LEFTTHREAD) != LEFTTHREAD)
-
-            if ((thread & RIGHTTHREAD) != RIGHTTHREAD)
+                curPtr = curPtr->leftChildPtr;
+                newPtr->leftChildPtr = allocateNode(curPtr->key, curPtr->value,
+                                                 newPtr->leftChildPtr, newPtr);
+                newPtr->threads -= LEFTTHREAD;
+                newPtr = newPtr->leftChildPtr;
+            }
+            else
             {
-                // continue down right branch, if not a thread
-                copyTree(treePtr->rightChildPtr, newTreePtr);
-            } // end if ((thread & RIGHTTHREAD) != RIGHTTHREAD)
-        }
-        catch (bad_alloc e)
-        {
-            throw TreeException(
-                    "TreeException: copyTree cannot allocate memory");
-        } // end try
+                // follow threads up to a right branch not yet copied
+                while ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+                {
+                    curPtr = curPtr->rightChildPtr;
+                    newPtr = newPtr->rightChildPtr;
+
+                    if (curPtr == NULL)
+                    {
+                        return;     // last inorder node reached
+                    } // end if (curPtr == NULL)
+                } // end while ((curPtr->threads & RIGHTTHREAD) == ...)
+
+                curPtr = curPtr->rightChildPtr;
+                newPtr->rightChildPtr = allocateNode(curPtr->key, curPtr->value,
+                                                newPtr, newPtr->rightChildPtr);
+                newPtr->threads -= RIGHTTHREAD;
+                newPtr = newPtr->rightChildPtr;
+            } // end if ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+            newPtr->balance = curPtr->balance;
+            newPtr->count = curPtr->count;
+        } // end for (;;)
     }
-    else
+    catch (bad_alloc e)
     {
-        newTreePtr = NULL;  // copy empty tree
-    } // end if (treePtr != NULL)
-} // end copyTree(ThreadedTreeNode*, ThreadedTreeNode*&)
+        destroyTree(newTreePtr);    // partial copy is still a valid tree
+        throw TreeException(
+                "TreeException: copyTree cannot allocate memory");
+    } // end try
+} // end copyTree(TreeNode*, TreeNode*&)
 
 /** Deallocates memory for a tree.
  * @param treePtr  Pointer to the root of the tree to be deallocated.
  * @pre None.
  * @post treePtr is an empty tree.
  */
-void ThreadedBST::destroyTree(ThreadedTreeNode *& treePtr)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::destroyTree(TreeNode *& treePtr)
+// Algorithm note: Nodes are deleted in order. The successor of a node is found
+// before the node is deleted, and finding it never touches an earlier node, so
+// the threads guide the walk without a stack or recursion.
 {
-    // postorder traversal
-    if (treePtr != NULL)
+    TreeNode *curPtr = treePtr;
+    TreeNode *delPtr;
+
+    if (curPtr == NULL)
     {
-        if ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-        {
-            treePtr->leftChildPtr = NULL;
-        } // end if ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD)
+        return;     // nothing to deallocate
+    } // end if (curPtr == NULL)
 
-        if ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+    while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+    {
+        curPtr = curPtr->leftChildPtr;  // find inorder first node
+    } // end while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+    while (curPtr != NULL)
+    {
+        delPtr = curPtr;
+
+        if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+        {
+            // Right pointer is thread pointer to inorder successor
+            curPtr = curPtr->rightChildPtr;
+        }
+        else
         {
-            treePtr->rightChildPtr = NULL;
-        } // end if (treePtr->threads == RIGHTTHREAD)
+            // Find leftmost node of right branch
+            curPtr = curPtr->rightChildPtr;
+
+            while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+            {
+                curPtr = curPtr->leftChildPtr;
+            } // end while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        } // end if ((curPtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+
+        deallocateNode(delPtr);
+    } // end while (curPtr != NULL)
+
+    treePtr = NULL;
+} // end destroyTree(TreeNode*&)
+
+/** Constructs a node in storage drawn from the node pool of this tree.
+ * @param nodeKey  The search key of the new node.
+ * @param nodeValue  The value of the new node.
+ * @param left  The left thread pointer of the new node.
+ * @param right  The right thread pointer of the new node.
+ * @pre None.
+ * @post A node holding nodeKey and nodeValue exists, with both threads set.
+ * @return A pointer to the new node.
+ * @throw bad_alloc  If the node cannot be allocated.
+ */
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::TreeNode*
+ThreadedBST<Key, Value, Compare>::allocateNode(const Key& nodeKey,
+                                               const Value& nodeValue,
+                                               TreeNode *left,
+                                               TreeNode *right)
+{
+    void *chunk = pool.allocate();
+
+    try
+    {
+        return new (chunk) TreeNode(nodeKey, nodeValue, left, right);
+    }
+    catch (...)
+    {
+        pool.deallocate(chunk);     // key or value could not be copied
+        throw;
+    } // end try
+} // end allocateNode(Key&, Value&, TreeNode*, TreeNode*)
+
+/** Constructs a node in storage drawn from the node pool of this tree, moving
+ *  the key and value into it.
+ * @param nodeKey  The search key of the new node.
+ * @param nodeValue  The value of the new node.
+ * @param left  The left thread pointer of the new node.
+ * @param right  The right thread pointer of the new node.
+ * @pre None.
+ * @post A node holding nodeKey and nodeValue exists, with both threads set.
+ *       nodeKey and nodeValue are left in a valid but unspecified state.
+ * @return A pointer to the new node.
+ * @throw bad_alloc  If the node cannot be allocated; nodeKey and nodeValue
+ *        are then unchanged.
+ */
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::TreeNode*
+ThreadedBST<Key, Value, Compare>::allocateNode(Key&& nodeKey,
+                                               Value&& nodeValue,
+                                               TreeNode *left,
+                                               TreeNode *right)
+{
+    void *chunk = pool.allocate();
+
+    try
+    {
+        return new (chunk) TreeNode(move(nodeKey), move(nodeValue),
+                                    left, right);
+    }
+    catch (...)
+    {
+        pool.deallocate(chunk);     // key or value could not be moved
+        throw;
+    } // end try
+} // end allocateNode(Key&&, Value&&, TreeNode*, TreeNode*)
+
+/** Destroys a node and returns its storage to the node pool of this tree.
+ * @param nodePtr  The node to be destroyed.
+ * @pre nodePtr was made by allocateNode() of this tree and is no longer
+ *      linked into it.
+ * @post The node is destroyed and its storage may be reused.
+ */
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::deallocateNode(TreeNode *nodePtr)
+{
+    nodePtr->~TreeNode();
+    pool.deallocate(nodePtr);
+} // end deallocateNode(TreeNode*)
+
+/** Counts the nodes in one subtree of a tree node.
+ * @param nodePtr  The node whose subtree is counted; nodePtr != NULL.
+ * @param side  LEFTTHREAD for the left subtree, RIGHTTHREAD for the right.
+ * @pre The subtree counts below nodePtr are correct.
+ * @post None.
+ * @return The number of nodes in the subtree, 0 if that side is a thread.
+ */
+template <class Key, class Value, class Compare>
+int ThreadedBST<Key, Value, Compare>::childCount(TreeNode *nodePtr,
+                                                 int side) const
+{
+    if ((nodePtr->threads & side) == side)
+    {
+        return 0;       // a thread is not a subtree
+    } // end if ((nodePtr->threads & side) == side)
 
-        destroyTree(treePtr->leftChildPtr);
-        destroyTree(treePtr->rightChildPtr);
-        delete treePtr;
-        treePtr = NULL;
-    } // end if (treePtr != NULL)
-} // end destroyTree(ThreadedTreeNode*&)
+    return (side == LEFTTHREAD ? nodePtr->leftChildPtr->count :
+                                 nodePtr->rightChildPtr->count);
+} // end childCount(TreeNode*, int)
+
+/** Recomputes the subtree count of a tree node from its children.
+ * @param nodePtr  The node to recount; nodePtr != NULL.
+ * @pre The subtree counts of the children of nodePtr are correct.
+ * @post The subtree count of nodePtr is correct.
+ */
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::recount(TreeNode *nodePtr)
+{
+    nodePtr->count = childCount(nodePtr, LEFTTHREAD) +
+                     childCount(nodePtr, RIGHTTHREAD) + 1;
+} // end recount(TreeNode*)
 
 /** Retrieves the value of the private data member root.
  * @pre None.
  * @post None.
- * @return A pointer to the root of this tree, as a ThreadedTreeNode.
+ * @return A pointer to the root of this tree, as a TreeNode.
  */
-ThreadedTreeNode* ThreadedBST::rootPtr() const
+template <class Key, class Value, class Compare>
+typename ThreadedBST<Key, Value, Compare>::TreeNode*
+ThreadedBST<Key, Value, Compare>::rootPtr() const
 {
     return root;
 } // end rootPtr()
@@ -662,10 +1558,11 @@ ThreadedTreeNode* ThreadedBST::rootPtr() const
  *        this tree.
  * @pre newRoot does not have a parent.
  */
-void ThreadedBST::setRootPtr(ThreadedTreeNode *newRoot)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::setRootPtr(TreeNode *newRoot)
 {
     root = newRoot;
-} // end setRootPtr(ThreadedTreeNode*)
+} // end setRootPtr(TreeNode*)
 
 /** Retrieves the values of the left and right child pointers of a tree node.
  * @param nodePtr  The node from which to retrieve child pointers.
@@ -674,13 +1571,14 @@ void ThreadedBST::setRootPtr(ThreadedTreeNode *newRoot)
  * @pre None.
  * @post leftPtr and rightPtr contain the child pointers of nodePtr.
  */
-void ThreadedBST::getChildPtrs(ThreadedTreeNode *nodePtr,
-                               ThreadedTreeNode *& leftPtr,
-                               ThreadedTreeNode *& rightPtr) const
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::getChildPtrs(TreeNode *nodePtr,
+                                                    TreeNode *& leftPtr,
+                                                    TreeNode *& rightPtr) const
 {
     leftPtr = nodePtr->leftChildPtr;
     rightPtr = nodePtr->rightChildPtr;
-} // end getChildPtrs(ThreadedTreeNode*, ThreadedTreeNode*&, ...)
+} // end getChildPtrs(TreeNode*, TreeNode*&, ...)
 
 /** Sets the values of the left and right child pointers of a tree node.
  * @param nodePtr  The node in which to set the child pointers.
@@ -691,93 +1589,196 @@ void ThreadedBST::getChildPtrs(ThreadedTreeNode *nodePtr,
  * @post nodePtr's left child pointer is leftPtr and its right child pointer is
  *       rightPtr.
  */
-void ThreadedBST::setChildPtrs(ThreadedTreeNode *nodePtr,
-                               ThreadedTreeNode *leftPtr,
-                               ThreadedTreeNode *rightPtr)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::setChildPtrs(TreeNode *nodePtr,
+                                                    TreeNode *leftPtr,
+                                                    TreeNode *rightPtr)
 {
     nodePtr->leftChildPtr = leftPtr;
     nodePtr->rightChildPtr = rightPtr;
-} // end setChildPtrs(ThreadedTreeNode*, ThreadedTreeNode*, ThreadedTreeNode*)
+} // end setChildPtrs(TreeNode*, TreeNode*, TreeNode*)
 
 /** Traverses a threaded binary search tree in preorder, starting at treePtr,
  *  and calls function visit() once for each item.
  * @param treePtr  Node at which to begin traversal.
- * @param visit  A function to perform at every traversed node.
- * @pre The function represented by visit() exists outside of the class
- *      implemenation.
+ * @param visit  A function, or function object, to perform at every
+ *        traversed node.
+ * @pre treePtr is the root of this tree.
  * @post visit's action occurred once for each item in the tree from treePtr
  *       on.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::preorder(ThreadedTreeNode *treePtr, FunctionType visit)
+template <class Key, class Value, class Compare>
+template <class Function>
+void ThreadedBST<Key, Value, Compare>::preorder(TreeNode *treePtr,
+                                                Function& visit) const
 {
-    if (treePtr != NULL)
+    while (treePtr != NULL)
     {
-        visit(treePtr->item);
+        visit(treePtr->key, treePtr->value);
 
         if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
         {
-            preorder(treePtr->leftChildPtr, visit);
-        } // end if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
-
-        if ((treePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+            treePtr = treePtr->leftChildPtr;
+        }
+        else
         {
-            preorder(treePtr->rightChildPtr, visit);
-        } // end if ((treePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
-    } // end if (treePtr != NULL)
-} // end preorder(ThreadedTreeNode*, FunctionType)
+            // follow threads up to the next right branch not yet visited
+            while (treePtr != NULL &&
+                   (treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+            {
+                treePtr = treePtr->rightChildPtr;
+            } // end while (treePtr != NULL ...)
+
+            if (treePtr != NULL)
+            {
+                treePtr = treePtr->rightChildPtr;
+            } // end if (treePtr != NULL)
+        } // end if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+    } // end while (treePtr != NULL)
+} // end preorder(TreeNode*, Function&)
 
 /** Traverses a threaded binary search tree in sorted order, starting at
  *  treePtr, and calls function visit() once for each item.
  * @param treePtr  Node at which to begin traversal.
- * @param visit  A function to perform at every traversed node.
- * @pre The function represented by visit() exists outside of the class
- *      implemenation.
+ * @param visit  A function, or function object, to perform at every
+ *        traversed node.
+ * @pre treePtr is the root of this tree.
  * @post visit's action occurred once for each item in the tree from treePtr
  *       on.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::inorder(ThreadedTreeNode *treePtr, FunctionType visit)
+template <class Key, class Value, class Compare>
+template <class Function>
+void ThreadedBST<Key, Value, Compare>::inorder(TreeNode *treePtr,
+                                               Function& visit) const
 {
-    if (treePtr != NULL)
+    if (treePtr == NULL)
     {
-        if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        return;
+    } // end if (treePtr == NULL)
+
+    while ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+    {
+        treePtr = treePtr->leftChildPtr;    // find inorder first node
+    } // end while ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+    while (treePtr != NULL)
+    {
+        visit(treePtr->key, treePtr->value);
+
+        if ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
         {
-            inorder(treePtr->leftChildPtr, visit);
-        } // end if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+            // Right pointer is thread pointer to inorder successor
+            treePtr = treePtr->rightChildPtr;
+        }
+        else
+        {
+            // Find leftmost node of right branch
+            treePtr = treePtr->rightChildPtr;
 
-        visit(treePtr->item);
-        inorder(treePtr->rightChildPtr, visit);
-    } // end if (treePtr != NULL)
-} // end inorder(ThreadedTreeNode*, FunctionType)
+            while ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+            {
+                treePtr = treePtr->leftChildPtr;
+            } // end while ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        } // end if ((treePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
+    } // end while (treePtr != NULL)
+} // end inorder(TreeNode*, Function&)
 
 /** Traverses a threaded binary search tree in postorder, starting at treePtr,
  *  and calls function visit() once for each item.
  * @param treePtr  Node at which to begin traversal.
- * @param visit  A function to perform at every traversed node.
- * @pre The function represented by visit() exists outside of the class
- *      implemenation.
+ * @param visit  A function, or function object, to perform at every
+ *        traversed node.
+ * @pre None.
  * @post visit's action occurred once for each item in the tree from treePtr
  *       on.
  * @note visit() can alter the tree.
  */
-void ThreadedBST::postorder(ThreadedTreeNode *treePtr, FunctionType visit)
+template <class Key, class Value, class Compare>
+template <class Function>
+void ThreadedBST<Key, Value, Compare>::postorder(TreeNode *treePtr,
+                                                 Function& visit) const
+// Algorithm note: Threads do not lead from a child back to its parent, so the
+// ancestors still waiting to be visited are kept on a heap-allocated stack
+// rather than on the call stack.
 {
-    if (treePtr != NULL)
+    vector<TreeNode*> pending;      // ancestors not yet visited
+    TreeNode         *lastPtr = NULL;   // node visited most recently
+    TreeNode         *topPtr;
+
+    while (treePtr != NULL || !pending.empty())
     {
-        if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+        if (treePtr != NULL)
         {
-            postorder(treePtr->leftChildPtr, visit);
-        } // end if ((treePtr->threads & LEFTTHREAD) != LEFTTHREAD)
+            // descend the left branch, saving each node for later
+            pending.push_back(treePtr);
+            treePtr = ((treePtr->threads & LEFTTHREAD) == LEFTTHREAD ?
+                       NULL : treePtr->leftChildPtr);
+        }
+        else
+        {
+            topPtr = pending.back();
 
-        if ((treePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+            if ((topPtr->threads & RIGHTTHREAD) != RIGHTTHREAD &&
+                topPtr->rightChildPtr != lastPtr)
+            {
+                treePtr = topPtr->rightChildPtr;    // right branch is next
+            }
+            else
+            {
+                visit(topPtr->key, topPtr->value);    // both branches are done
+                lastPtr = topPtr;
+                pending.pop_back();
+            } // end if ((topPtr->threads & RIGHTTHREAD) != RIGHTTHREAD ...)
+        } // end if (treePtr != NULL)
+    } // end while (treePtr != NULL || !pending.empty())
+} // end postorder(TreeNode*, Function&)
+
+/** Traverses the items of a threaded binary search tree whose ranks lie in a
+ *  given range. Run on a worker thread by parallelInorderTraverse().
+ * @param first  The rank of the first item to visit.
+ * @param last  One past the rank of the last item to visit.
+ * @param visit  An object callable as visit(const Key&, const Value&).
+ * @param error  A container for anything visit throws.
+ * @pre 0 <= first <= last <= getLength().
+ * @post visit has been called once for each item in the range, in sorted
+ *       order, unless it threw; error then holds what it threw.
+ */
+template <class Key, class Value, class Compare>
+template <class Function>
+void ThreadedBST<Key, Value, Compare>::inorderRange(int first, int last,
+                                                    Function& visit,
+                                                    exception_ptr& error) const
+{
+    ConstVisitor<Function> readOnly(visit);
+
+    if (first == last)
+    {
+        return;
+    } // end if (first == last)
+
+    try
+    {
+        Inorder index(select(first));
+
+        for (;;)
         {
-            postorder(treePtr->rightChildPtr, visit);
-        } // end if ((treePtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+            readOnly(index.cur->key, index.cur->value);
 
-        visit(treePtr->item);
-    } // end if (treePtr != NULL)
-} // end preorder(ThreadedTreeNode*, FunctionType)
+            if (++first == last)
+            {
+                break;      // last item of the range visited
+            } // end if (++first == last)
+
+            ++index;
+        } // end for (;;)
+    }
+    catch (...)
+    {
+        error = current_exception();    // rethrown on the calling thread
+    } // end try
+} // end inorderRange(int, int, Function&, exception_ptr&)
 
 /** Locates the leftmost node in a subtree to connect its left thread pointer
  *  to a new predecessor. Called by deleteNodeItem().
@@ -790,20 +1791,21 @@ void ThreadedBST::postorder(ThreadedTreeNode *treePtr, FunctionType visit)
  * @post The left thread pointer of this node points to the predecessor of its
  *       inorder predecessor; may be NULL.
  */
-void ThreadedBST::passPredecessor(ThreadedTreeNode *& nodePtr,
-                                  ThreadedTreeNode *newPredecessor)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::passPredecessor(TreeNode *& nodePtr,
+                                                       TreeNode *newPredecessor)
 {
-    if ((nodePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-    {
-        // Leftmost descendant found - set left thread pointer
-        // Assert: old predecessor must be deleted, or threads will break
-        nodePtr->leftChildPtr = newPredecessor;
-    }
-    else
+    TreeNode *curPtr = nodePtr;
+
+    while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
     {
-        passPredecessor(nodePtr->leftChildPtr, newPredecessor);
-    } // end if ((nodePtr->threads & LEFTTHREAD) == LEFTTHREAD)
-}  // end passPredecessor(ThreadedTreeNode*&, ThreadedTreeNode*)
+        curPtr = curPtr->leftChildPtr;
+    } // end while ((curPtr->threads & LEFTTHREAD) != LEFTTHREAD)
+
+    // Leftmost descendant found - set left thread pointer
+    // Assert: old predecessor must be deleted, or threads will break
+    curPtr->leftChildPtr = newPredecessor;
+}  // end passPredecessor(TreeNode*&, TreeNode*)
 
 /** Locates the leftmost node in a subtree to connect its left thread pointer
  *  to a new successor. Called by deleteNodeItem().
@@ -816,17 +1818,21 @@ void ThreadedBST::passPredecessor(ThreadedTreeNode *& nodePtr,
  * @post The right thread pointer of this node points to the successor of its
  *       inorder successor; may be NULL.
  */
-void ThreadedBST::passSuccessor(ThreadedTreeNode *& nodePtr,
-                                ThreadedTreeNode *newSuccessor)
+template <class Key, class Value, class Compare>
+void ThreadedBST<Key, Value, Compare>::passSuccessor(TreeNode *& nodePtr,
+                                                     TreeNode *newSuccessor)
 {
-    if ((nodePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
-    {
-        // Rightmost descendant found - set right thread pointer
-        // Assert: old successor must be deleted, or threads will break
-        nodePtr->rightChildPtr = newSuccessor;
-    }
-    else
+    TreeNode *curPtr = nodePtr;
+
+    while ((curPtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
     {
-        passSuccessor(nodePtr->rightChildPtr, newSuccessor);
-    } // end if ((nodePtr->threads & RIGHTTHREAD) == RIGHTTHREAD)
-}  // end passSuccessor(ThreadedTreeNode*&, ThreadedTreeNode*)
+        curPtr = curPtr->rightChildPtr;
+    } // end while ((curPtr->threads & RIGHTTHREAD) != RIGHTTHREAD)
+
+    // Rightmost descendant found - set right thread pointer
+    // Assert: old successor must be deleted, or threads will break
+    curPtr->rightChildPtr = newSuccessor;
+}  // end passSuccessor(TreeNode*&, TreeNode*)
+
+
+#endif	/* _THREADEDBST_CPP */
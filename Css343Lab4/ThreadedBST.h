@@ -16,6 +16,10 @@
  *          left thread, 2 = right thread, 3 = both threads. Since left thread
  *          and right thread are both powers of 2, binary arithmetic is used to
  *          make comparisons and set the threads indicator element of a node.
+ *          The tree is a template over its key type, its value type and the
+ *          ordering of its keys, so each container stores only what it needs.
+ *          Lookups accept any search key that the ordering can compare with a
+ *          stored key, so a caller need not build a Key just to search.
  * @author  Brendan Sweeney, SID 1161836
  * @date    December 8, 2011
  */
@@ -23,16 +27,99 @@
 #ifndef _THREADEDBST_H
 #define	_THREADEDBST_H
 
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+#include "NodePool.h"
 #include "ThreadedTreeNode.h"
 #include "TreeException.h"
 
+// A parallel traversal of fewer items than this for each range is walked on
+// the calling thread, where starting the workers would cost more than it saves.
+const int MINPARALLELITEMS = 4096;
+
+/** Default ordering for the keys of a ThreadedBST. The comparison is itself a
+ *  template, so the two operands need not share a type; any pair for which
+ *  operator< is defined may be compared, such as a string and a C string.
+ */
+class KeyLess
+{
+public:
+
+    template <class Lhs, class Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return lhs < rhs;
+    } // end operator()(Lhs&, Rhs&)
+
+    /** Orders two operands with one comparison where the type allows it.
+     *  Strings are compared once, character by character, instead of once in
+     *  each direction. Other types fall back to two calls of operator<.
+     * @param lhs  The first operand.
+     * @param rhs  The second operand.
+     * @pre None.
+     * @post None.
+     * @return A negative number if lhs comes before rhs, zero if neither
+     *         comes before the other, or a positive number otherwise.
+     */
+    template <class Lhs, class Rhs>
+    int order(const Lhs& lhs, const Rhs& rhs) const
+    {
+        return (lhs < rhs ? -1 : (rhs < lhs ? 1 : 0));
+    } // end order(Lhs&, Rhs&)
+
+    int order(const string& lhs, const string& rhs) const
+    {
+        return lhs.compare(rhs);
+    } // end order(string&, string&)
+
+    int order(const string& lhs, const char *rhs) const
+    {
+        return lhs.compare(rhs);
+    } // end order(string&, char*)
+
+    int order(const char *lhs, const string& rhs) const
+    {
+        int result = rhs.compare(lhs);
+
+        return (result < 0 ? 1 : (result > 0 ? -1 : 0));
+    } // end order(char*, string&)
+}; // end KeyLess
+
+
+/** Orders two keys with a given ordering, using one three-way comparison
+ *  where the ordering provides it. Any ordering works here; one without an
+ *  order() member is simply called in both directions.
+ * @param compare  The ordering of the keys.
+ * @param lhs  The first key.
+ * @param rhs  The second key.
+ * @pre None.
+ * @post None.
+ * @return A negative number if lhs comes before rhs, zero if neither comes
+ *         before the other, or a positive number otherwise.
+ */
+template <class Compare, class Lhs, class Rhs>
+inline int keyOrder(const Compare& compare, const Lhs& lhs, const Rhs& rhs)
+{
+    return (compare(lhs, rhs) ? -1 : (compare(rhs, lhs) ? 1 : 0));
+} // end keyOrder(Compare&, Lhs&, Rhs&)
+
+template <class Lhs, class Rhs>
+inline int keyOrder(const KeyLess& compare, const Lhs& lhs, const Rhs& rhs)
+{
+    return compare.order(lhs, rhs);
+} // end keyOrder(KeyLess&, Lhs&, Rhs&)
 
-typedef void (*FunctionType)(TreeItemType& anItem);
 
+template <class Key, class Value, class Compare = KeyLess>
 class ThreadedBST
 {
 public:
 
+    typedef ThreadedTreeNode<Key, Value> TreeNode;
+    typedef void (*FunctionType)(const Key& aKey, Value& aValue);
+
     friend class Inorder;
 
     class Inorder
@@ -41,7 +128,7 @@ public:
 
         friend class ThreadedBST;
 
-        Inorder(const ThreadedBST *aTree, ThreadedTreeNode *aNode);
+        Inorder(const ThreadedBST *aTree, TreeNode *aNode);
 
         Inorder(const Inorder& orig);
 
@@ -54,11 +141,17 @@ public:
          */
         void operator=(const Inorder& rhs);
 
-        /** Obtain a reference to the item to which this iterator points.
+        /** Obtain a reference to the value to which this iterator points.
+         * @pre This iterator points to a node that contains a data item.
+         * @post None
+         */
+        const Value& operator*(void) const;
+
+        /** Obtain a reference to the key of the node this iterator points to.
          * @pre This iterator points to a node that contains a data item.
          * @post None
          */
-        const TreeItemType& operator*(void);
+        const Key& getKey(void) const;
 
         /** Move this iterator to the next inorder node in its container.
          * @pre This iterator is not already at the last inorder element.
@@ -115,7 +208,7 @@ public:
     private:
 
         const ThreadedBST *container;   // containing object
-        ThreadedTreeNode  *cur;         // current element of container
+        TreeNode          *cur;         // current element of container
 
     }; // end Inorder
     
@@ -127,6 +220,15 @@ public:
     ThreadedBST(const ThreadedBST& orig)
             throw(TreeException);
 
+    /** Creates a tree that takes over the nodes of another tree.
+     * @param orig  The tree whose nodes are taken.
+     * @pre None.
+     * @post This tree holds the items orig held, without copying any of
+     *       them; orig is empty. Iterators into orig are invalidated.
+     */
+    ThreadedBST(ThreadedBST&& orig)
+            throw();
+
     virtual ~ThreadedBST();
     
     /** Determines whether a threaded binary search tree is empty.
@@ -137,15 +239,29 @@ public:
     virtual bool isEmpty() const;
     
     /** Inserts an item into a threaded binary search tree.
-     * @param newItem  A value, passed by reference, to be added to the tree.
-     * @pre The item to e inserted into the tree is newItem.
-     * @post newItem is in its proper order in the tree. If newItem has an
+     * @param newKey  The search key of the item to be added to the tree.
+     * @param newValue  The value to be stored under newKey.
+     * @pre The item to e inserted into the tree is newKey and newValue.
+     * @post newKey is in its proper order in the tree. If newKey has an
      *       inorder successor or inorder predecessor already in the tree, a
-     *       thread pointer is set in newItem's node to point to the nodes that
+     *       thread pointer is set in newKey's node to point to the nodes that
      *       contain those items.
      * @throw TreeException  If memory allocations fails.
      */
-    virtual void searchTreeInsert(const TreeItemType& newItem)
+    virtual void searchTreeInsert(const Key& newKey, const Value& newValue)
+                 throw(TreeException);
+
+    /** Inserts an item into a threaded binary search tree, moving the key and
+     *  value into the new node rather than copying them.
+     * @param newKey  The search key of the item to be added to the tree.
+     * @param newValue  The value to be stored under newKey.
+     * @pre The item to be inserted into the tree is newKey and newValue.
+     * @post newKey is in its proper order in the tree. newKey and newValue
+     *       are left in a valid but unspecified state, unless memory
+     *       allocation fails, in which case they are unchanged.
+     * @throw TreeException  If memory allocations fails.
+     */
+    virtual void searchTreeInsert(Key&& newKey, Value&& newValue)
                  throw(TreeException);
     
     /** Deletes an item with a given search key from a threaded binary search
@@ -156,22 +272,132 @@ public:
      *       the item is deleted. Otherwise, the tree is unchanged.
      * @throw TreeException  If searchKey is not found in the tree.
      */
-    virtual void searchTreeDelete(KeyType searchKey)
+    virtual void searchTreeDelete(const Key& searchKey)
                  throw(TreeException);
     
     /** Retrieves an item with a given search key from a threaded binary search
      *  tree.
-     * @param searchKey  The search key of the item to be located.
-     * @param treeItem  A container for the found item.
+     * @param searchKey  The search key of the item to be located. May be of
+     *        any type that Compare can order against Key.
+     * @param treeValue  A container for the value of the found item.
      * @pre searchKey is the search key of the item to be retrieved.
-     * @post If the retrieval was successful, treeItem contains the retrieved
-     *       item.
+     * @post If the retrieval was successful, treeValue contains the value of
+     *       the retrieved item.
      * @throw TreeException  If no such item exists.
      */
-    virtual void searchTreeRetrive(KeyType searchKey,
-                                   TreeItemType& treeItem) const
-                 throw(TreeException);
-    
+    template <class SearchKey>
+    void searchTreeRetrive(const SearchKey& searchKey,
+                           Value& treeValue) const
+         throw(TreeException);
+
+    /** Retrieves an item with a given search key from a threaded binary search
+     *  tree, reporting a missing item by its result rather than by throwing.
+     *  Meant for lookups that often miss.
+     * @param searchKey  The search key of the item to be located. May be of
+     *        any type that Compare can order against Key.
+     * @param treeValue  A container for the value of the found item.
+     * @pre None.
+     * @post If the retrieval was successful, treeValue contains the value of
+     *       the retrieved item; otherwise, treeValue is unchanged.
+     * @return true if an item has searchKey; false, otherwise.
+     */
+    template <class SearchKey>
+    bool tryRetrieve(const SearchKey& searchKey, Value& treeValue) const;
+
+    /** Locates the value of an item so that it can be changed in place. The
+     *  key cannot be reached this way, so the order of the tree is kept; to
+     *  change a key, delete the item and insert it again.
+     * @param searchKey  The search key of the item to be located. May be of
+     *        any type that Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return A pointer to the value of the located item, or NULL if no item
+     *         has searchKey. The pointer is valid until the tree is next
+     *         changed by an insertion or deletion.
+     */
+    template <class SearchKey>
+    Value* findMutable(const SearchKey& searchKey);
+
+    /** Replaces the contents of a threaded binary search tree with the items
+     *  of a sorted range, building a balanced tree in linear time.
+     * @param first  Iterator to the first item of the range. Each item is a
+     *        pair whose first member is a Key and second member is a Value.
+     * @param last  Iterator just past the last item of the range.
+     * @pre The keys in [first, last) are in nondecreasing order under Compare.
+     * @post This tree holds exactly the items of the range, in the same
+     *       order, with every thread set. No node has subtrees whose heights
+     *       differ by more than one, so the tree is also a valid AVL tree.
+     * @throw TreeException  If the range is not sorted or memory allocation
+     *        fails; the tree is left unchanged.
+     */
+    template <class InputIterator>
+    void searchTreeBuild(InputIterator first, InputIterator last)
+         throw(TreeException);
+
+    /** Locates the first item whose key is not less than a given search key.
+     * @param searchKey  The search key at which to start. May be of any type
+     *        that Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return An iterator to the located item. If every key is less than
+     *         searchKey, the iterator is one step past end() and must not be
+     *         dereferenced.
+     */
+    template <class SearchKey>
+    Inorder lowerBound(const SearchKey& searchKey) const;
+
+    /** Locates the first item whose key is greater than a given search key.
+     * @param searchKey  The search key at which to start. May be of any type
+     *        that Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return An iterator to the located item. If no key is greater than
+     *         searchKey, the iterator is one step past end() and must not be
+     *         dereferenced.
+     */
+    template <class SearchKey>
+    Inorder upperBound(const SearchKey& searchKey) const;
+
+    /** Locates every item whose key is equal to a given search key.
+     * @param searchKey  The search key to match. May be of any type that
+     *        Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return The pair lowerBound(searchKey), upperBound(searchKey). Advancing
+     *         from the first iterator until it equals the second visits each
+     *         matching item; the two are equal if there is no match.
+     */
+    template <class SearchKey>
+    pair<Inorder, Inorder> equalRange(const SearchKey& searchKey) const;
+
+    /** Counts the items in a threaded binary search tree.
+     * @pre None.
+     * @post None.
+     * @return The number of items in the tree.
+     */
+    int getLength(void) const;
+
+    /** Locates the item at a given position in sorted order.
+     * @param index  The zero-based position of the item to locate.
+     * @pre 0 <= index < getLength().
+     * @post None.
+     * @return An iterator to the item that has index items before it.
+     * @throw TreeException  If index is out of range.
+     */
+    Inorder select(int index) const
+            throw(TreeException);
+
+    /** Counts the items whose keys are less than a given search key.
+     * @param searchKey  The search key to rank. May be of any type that
+     *        Compare can order against Key.
+     * @pre None.
+     * @post None.
+     * @return The position that lowerBound(searchKey) would have in sorted
+     *         order, from 0 up to getLength().
+     */
+    template <class SearchKey>
+    int rank(const SearchKey& searchKey) const;
+
     /** Traverses a threaded binary search tree in preorder, calling function
      *  visit() once for each item.
      * @param visit  A function to perform on every traversed node.
@@ -201,6 +427,101 @@ public:
      * @note visit() can alter the tree.
      */
     virtual void postorderTraverse(FunctionType visit);
+
+    /** Traverses a threaded binary search tree in preorder, calling a
+     *  function object once for each item. The call is made directly rather
+     *  than through a pointer, so it can be inlined, and the object can keep
+     *  state from one item to the next.
+     * @param visit  Any object callable as visit(const Key&, Value&).
+     * @pre None.
+     * @post visit has been called once for each item in the tree.
+     * @return visit, as it was after the last item, so that state it has
+     *         gathered can be read.
+     * @note visit() may change values, but not keys or the shape of the tree.
+     */
+    template <class Function>
+    Function preorderTraverse(Function visit);
+
+    /** Traverses a threaded binary search tree in sorted order, calling a
+     *  function object once for each item. The call is made directly rather
+     *  than through a pointer, so it can be inlined, and the object can keep
+     *  state from one item to the next.
+     * @param visit  Any object callable as visit(const Key&, Value&).
+     * @pre None.
+     * @post visit has been called once for each item in the tree.
+     * @return visit, as it was after the last item, so that state it has
+     *         gathered can be read.
+     * @note visit() may change values, but not keys or the shape of the tree.
+     */
+    template <class Function>
+    Function inorderTraverse(Function visit);
+
+    /** Traverses a threaded binary search tree in sorted order, calling a
+     *  function object once for each item without changing any of them.
+     * @param visit  Any object callable as visit(const Key&, const Value&).
+     * @pre None.
+     * @post visit has been called once for each item in the tree.
+     * @return visit, as it was after the last item, so that state it has
+     *         gathered can be read.
+     */
+    template <class Function>
+    Function inorderTraverse(Function visit) const;
+
+    /** Traverses a threaded binary search tree in postorder, calling a
+     *  function object once for each item. The call is made directly rather
+     *  than through a pointer, so it can be inlined, and the object can keep
+     *  state from one item to the next.
+     * @param visit  Any object callable as visit(const Key&, Value&).
+     * @pre None.
+     * @post visit has been called once for each item in the tree.
+     * @return visit, as it was after the last item, so that state it has
+     *         gathered can be read.
+     * @note visit() may change values, but not keys or the shape of the tree.
+     * @throw bad_alloc  If the stack of pending ancestors cannot grow.
+     */
+    template <class Function>
+    Function postorderTraverse(Function visit);
+
+    /** Traverses a threaded binary search tree in sorted order on several
+     *  threads at once. The items are split by rank into as many consecutive
+     *  ranges as there are function objects, of sizes differing by at most
+     *  one, and each range is walked by its own thread. Reading the function
+     *  objects in index order afterwards is the same as one serial inorder
+     *  walk.
+     * @param visitors  One object for each range, each callable as
+     *        visit(const Key&, const Value&). visitors[0] sees the lowest
+     *        keys.
+     * @pre The tree is not changed by any thread until the call returns.
+     * @post Each object in visitors has been called once for each item in its
+     *       range, in sorted order.
+     * @throw  Whatever a function object throws, once every range is done.
+     *         If threads cannot be started, the ranges are walked on the
+     *         calling thread instead.
+     * @note Ranges of fewer than MINPARALLELITEMS items are all walked on the
+     *       calling thread.
+     */
+    template <class Function>
+    void parallelInorderTraverse(vector<Function>& visitors) const;
+
+    /** Traverses a threaded binary search tree in sorted order on several
+     *  threads at once and merges what the threads gather in key order.
+     *  Each thread walks one range with its own copy of visit. The copies
+     *  are then merged from the lowest range to the highest, so a visitor
+     *  that appends to its output produces the same result as a serial walk.
+     * @param visit  An object callable as visit(const Key&, const Value&),
+     *        copied once for each thread.
+     * @param threadCount  The number of ranges, and so of threads, to use.
+     * @param merge  An object callable as merge(Function& lower,
+     *        const Function& higher), which folds higher into lower.
+     * @pre The tree is not changed by any thread until the call returns.
+     * @post None.
+     * @return The copy of visit for the lowest range, with every higher range
+     *         merged into it in order.
+     * @throw  Whatever visit or merge throws.
+     */
+    template <class Function, class Merge>
+    Function parallelInorderTraverse(const Function& visit, int threadCount,
+                                     Merge merge) const;
     
     /** Copies the contents of rhs into this tree.
      * @param rhs  The right-hand tree to be copied.
@@ -212,6 +533,17 @@ public:
     virtual ThreadedBST& operator=(const ThreadedBST& rhs)
                          throw(TreeException);
 
+    /** Moves the contents of rhs into this tree.
+     * @param rhs  The right-hand tree whose nodes are taken.
+     * @pre None.
+     * @post This tree holds the items rhs held, without copying any of them;
+     *       its own items are deallocated and rhs is empty. Iterators into
+     *       either tree are invalidated.
+     * @return The threaded binary search tree with newly-assigned values.
+     */
+    virtual ThreadedBST& operator=(ThreadedBST&& rhs)
+                         throw();
+
     /** Returns an iterator for the inorder first element of this tree.
      * @pre Tree is not empty.
      * @post None.
@@ -234,30 +566,23 @@ public:
     
 protected:
     
-    /** Recursively inserts an item into a threaded binary search tree.
-     * @param treePtr  Pointer to the node to start a check for insertion.
-     * @param predecessor  Thread pointer to the inorder predecessor of the
-     *        calling node's leftmost right descendant; NULL if not yet found.
-     * @param successor  Thread pointer to the inorder successor of the calling
-     *        node's rightmost left descendant; NULL if not yet found.
-     * @param newItem  The item to be inserted into this tree.
-     * @pre treePtr points to a threaded binary search tree, newItem is the
-     *      item to be inserted. If tree is empty or contains only root,
-     *      predecessor and successor must both be NULL.
-     * @post newItem is in its proper order in the tree. If newItem has an
-     *       inorder successor or inorder predecessor already in the tree, a
-     *       thread pointer is set in newItem's node to point to the nodes that
+    /** Links a new node into a threaded binary search tree without
+     *  recursion. Both forms of searchTreeInsert() allocate the node and then
+     *  call this, so a subclass that keeps the tree in some other shape
+     *  overrides this alone.
+     * @param treePtr  Pointer to the root of the tree in which to insert.
+     * @param newPtr  The node to be inserted, made by allocateNode().
+     * @pre treePtr points to a threaded binary search tree; newPtr is not
+     *      linked into any tree.
+     * @post The key of newPtr is in its proper order in the tree. If it has
+     *       an inorder successor or inorder predecessor already in the tree,
+     *       a thread pointer is set in newPtr to point to the nodes that
      *       contain those items.
-     * @throw TreeException  If memory allocations fails.
      */
-    void insertItem(ThreadedTreeNode *& treePtr,
-                    ThreadedTreeNode *predecessor,
-                    ThreadedTreeNode *successor,
-              const TreeItemType& newItem)
-         throw(TreeException);
+    virtual void insertItem(TreeNode *& treePtr, TreeNode *newPtr);
 
-    /** Recursively deletes an item from a threaded binary search tree.
-     * @param treePtr  Pointer to the node to start a check for deletion.
+    /** Deletes an item from a threaded binary search tree without recursion.
+     * @param treePtr  Pointer to the root of the tree from which to delete.
      * @parm searchKey  Search key of the item to be deleted from this tree.
      * @pre treePtr points to a binary search tree, searchKey is the search key
      *      of the item to be deleted.
@@ -265,7 +590,7 @@ protected:
      *       the item is deleted. Otherwise, the tree is unchanged.
      * @throw TreeException  If searchKey is not found in the tree.
      */
-    void deleteItem(ThreadedTreeNode *& treePtr, KeyType searchKey)
+    void deleteItem(TreeNode *& treePtr, const Key& searchKey)
          throw(TreeException);
 
     /** Deletes the item in the root of a given tree.
@@ -274,44 +599,60 @@ protected:
      *      nodePtr !- NULL.
      * @post The item in the root of the given tree is deleted.
      */
-    void deleteNodeItem(ThreadedTreeNode *& nodePtr);
+    void deleteNodeItem(TreeNode *& nodePtr);
 
     /** Retrieves and deletes the leftmost descendant of a given node.
      * @param nodePtr  Pointer to the node to start processing.
-     * @param treeItem  A container for the item in the node to be delete.
+     * @param treeKey  A container for the key in the node to be delete.
+     * @param treeValue  A container for the value in the node to be delete.
      * @pre nodePtr points to a node in a threaded binary search tree;
      *      nodePtr != NULL.
-     * @post treeItem contains the item in the leftmost descendant of the node
-     *       to which nodePtr points. The leftmost descendant of nodePtr is
-     *       deleted.
+     * @post treeKey and treeValue contain the item in the leftmost descendant
+     *       of the node to which nodePtr points. The leftmost descendant of
+     *       nodePtr is deleted.
      */
-    void processLeftmost(ThreadedTreeNode *& nodePtr, TreeItemType& treeItem);
+    void processLeftmost(TreeNode *& nodePtr, Key& treeKey, Value& treeValue);
 
-    /** Recursively retrieves an item from a threaded binary search tree.
+    /** Retrieves an item from a threaded binary search tree without
+     *  recursion.
      * @param treePtr  Pointer to the node at which to start searching.
      * @param searchKey  Search key of the item to be retrieved.
-     * @param treeItem  A container for the located item.
-     * @pre treePtr points to a binary search tree, treeItem is the search key
+     * @param treeValue  A container for the value of the located item.
+     * @pre treePtr points to a binary search tree, searchKey is the search key
      *      of the item to be retrieved.
-     * @post If the retrieval was successful, treeItem contains the retrieved
-     *       item.
+     * @post If the retrieval was successful, treeValue contains the value of
+     *       the retrieved item.
      * @throw TreeException  If no such item exists.
      */
-    void retrieveItem(ThreadedTreeNode *treePtr,
-                      KeyType searchKey,
-                      TreeItemType& treeItem) const
+    template <class SearchKey>
+    void retrieveItem(TreeNode *treePtr,
+                const SearchKey& searchKey,
+                      Value& treeValue) const
          throw(TreeException);
 
+    /** Finds the node of an item without recursion.
+     * @param treePtr  Pointer to the node at which to start searching.
+     * @param searchKey  Search key of the item to be found.
+     * @pre treePtr points to a binary search tree.
+     * @post None.
+     * @return The node whose key is equal to searchKey, or NULL if there is
+     *         none.
+     */
+    template <class SearchKey>
+    TreeNode* locateNode(TreeNode *treePtr,
+                         const SearchKey& searchKey) const;
+
     /** Copies the tree rooted at treePtr into a tree rooted at newTreePtr.
      * @param treePtr  The root of the tree to be copied.
      * @param newTreePtr  A container for the root of a copy of treePtr.
      * @pre There is sufficient memory to allocate a new tree.
      * @post newTreePtr points to the root of a structural copy of the tree
-     *       whose root is pointed to by treePtr.
+     *       whose root is pointed to by treePtr, including thread flags,
+     *       balances and subtree counts.
      * @throw TreeException  If a copy of the tree cannot be allocated.
      */
-    void copyTree(ThreadedTreeNode *treePtr,
-                  ThreadedTreeNode *& newTreePtr)
+    void copyTree(TreeNode *treePtr,
+                  TreeNode *& newTreePtr)
          throw(TreeException);
 
     /** Deallocates memory for a tree.
@@ -319,21 +660,76 @@ protected:
      * @pre None.
      * @post treePtr is an empty tree.
      */
-    void destroyTree(ThreadedTreeNode *& treePtr);
+    void destroyTree(TreeNode *& treePtr);
+
+    /** Constructs a node in storage drawn from the node pool of this tree.
+     * @param nodeKey  The search key of the new node.
+     * @param nodeValue  The value of the new node.
+     * @param left  The left thread pointer of the new node.
+     * @param right  The right thread pointer of the new node.
+     * @pre None.
+     * @post A node holding nodeKey and nodeValue exists, with both threads
+     *       set.
+     * @return A pointer to the new node.
+     * @throw bad_alloc  If the node cannot be allocated.
+     */
+    TreeNode* allocateNode(const Key& nodeKey, const Value& nodeValue,
+                           TreeNode *left, TreeNode *right);
+
+    /** Constructs a node in storage drawn from the node pool of this tree,
+     *  moving the key and value into it.
+     * @param nodeKey  The search key of the new node.
+     * @param nodeValue  The value of the new node.
+     * @param left  The left thread pointer of the new node.
+     * @param right  The right thread pointer of the new node.
+     * @pre None.
+     * @post A node holding nodeKey and nodeValue exists, with both threads
+     *       set. nodeKey and nodeValue are left in a valid but unspecified
+     *       state.
+     * @return A pointer to the new node.
+     * @throw bad_alloc  If the node cannot be allocated; nodeKey and
+     *        nodeValue are then unchanged.
+     */
+    TreeNode* allocateNode(Key&& nodeKey, Value&& nodeValue,
+                           TreeNode *left, TreeNode *right);
+
+    /** Destroys a node and returns its storage to the node pool of this tree.
+     * @param nodePtr  The node to be destroyed.
+     * @pre nodePtr was made by allocateNode() of this tree and is no longer
+     *      linked into it.
+     * @post The node is destroyed and its storage may be reused.
+     */
+    void deallocateNode(TreeNode *nodePtr);
+
+    /** Counts the nodes in one subtree of a tree node.
+     * @param nodePtr  The node whose subtree is counted; nodePtr != NULL.
+     * @param side  LEFTTHREAD for the left subtree, RIGHTTHREAD for the right.
+     * @pre The subtree counts below nodePtr are correct.
+     * @post None.
+     * @return The number of nodes in the subtree, 0 if that side is a thread.
+     */
+    int childCount(TreeNode *nodePtr, int side) const;
+
+    /** Recomputes the subtree count of a tree node from its children.
+     * @param nodePtr  The node to recount; nodePtr != NULL.
+     * @pre The subtree counts of the children of nodePtr are correct.
+     * @post The subtree count of nodePtr is correct.
+     */
+    void recount(TreeNode *nodePtr);
 
     /** Retrieves the value of the private data member root.
      * @pre None.
      * @post None.
-     * @return A pointer to the root of this tree, as a ThreadedTreeNode.
+     * @return A pointer to the root of this tree, as a TreeNode.
      */
-    ThreadedTreeNode* rootPtr() const;
+    TreeNode* rootPtr() const;
 
     /** Set the value of the private data member root.
      * @param newRoot  The root of a threaded binary search tree to be assigned
      *        to this tree.
      * @pre newRoot does not have a parent.
      */
-    void setRootPtr(ThreadedTreeNode *newRoot);
+    void setRootPtr(TreeNode *newRoot);
 
     /** Retrieves the values of the left and right child pointers of a tree
      *  node.
@@ -343,9 +739,9 @@ protected:
      * @pre None.
      * @post leftPtr and rightPtr contain the child pointers of nodePtr.
      */
-    void getChildPtrs(ThreadedTreeNode *nodePtr,
-                      ThreadedTreeNode *& leftPtr,
-                      ThreadedTreeNode *& rightPtr) const;
+    void getChildPtrs(TreeNode *nodePtr,
+                      TreeNode *& leftPtr,
+                      TreeNode *& rightPtr) const;
 
     /** Sets the values of the left and right child pointers of a tree node.
      * @param nodePtr  The node in which to set the child pointers.
@@ -356,45 +752,62 @@ protected:
      * @post nodePtr's left child pointer is leftPtr and its right child
      *       pointer is rightPtr.
      */
-    void setChildPtrs(ThreadedTreeNode *nodePtr,
-                      ThreadedTreeNode *leftPtr,
-                      ThreadedTreeNode *rightPtr);
+    void setChildPtrs(TreeNode *nodePtr,
+                      TreeNode *leftPtr,
+                      TreeNode *rightPtr);
     
     /** Traverses a threaded binary search tree in preorder, starting at
      *  treePtr, and calls function visit() once for each item.
      * @param treePtr  Node at which to begin traversal.
-     * @param visit  A function to perform at every traversed node.
-     * @pre The function represented by visit() exists outside of the class
-     *      implemenation.
+     * @param visit  A function, or function object, to perform at every
+     *        traversed node.
+     * @pre treePtr is the root of this tree.
      * @post visit's action occurred once for each item in the tree from
      *       treePtr on.
      * @note visit() can alter the tree.
      */
-    void preorder(ThreadedTreeNode *treePtr, FunctionType visit);
+    template <class Function>
+    void preorder(TreeNode *treePtr, Function& visit) const;
     
     /** Traverses a threaded binary search tree in sorted order, starting at
      *  treePtr, and calls function visit() once for each item.
      * @param treePtr  Node at which to begin traversal.
-     * @param visit  A function to perform at every traversed node.
-     * @pre The function represented by visit() exists outside of the class
-     *      implemenation.
+     * @param visit  A function, or function object, to perform at every
+     *        traversed node.
+     * @pre treePtr is the root of this tree.
      * @post visit's action occurred once for each item in the tree from
      *       treePtr on.
      * @note visit() can alter the tree.
      */
-    void inorder(ThreadedTreeNode *treePtr, FunctionType visit);
+    template <class Function>
+    void inorder(TreeNode *treePtr, Function& visit) const;
     
     /** Traverses a threaded binary search tree in postorder, starting at
      *  treePtr, and calls function visit() once for each item.
      * @param treePtr  Node at which to begin traversal.
-     * @param visit  A function to perform at every traversed node.
-     * @pre The function represented by visit() exists outside of the class
-     *      implemenation.
+     * @param visit  A function, or function object, to perform at every
+     *        traversed node.
+     * @pre None.
      * @post visit's action occurred once for each item in the tree from
      *       treePtr on.
      * @note visit() can alter the tree.
      */
-    void postorder(ThreadedTreeNode *treePtr, FunctionType visit);
+    template <class Function>
+    void postorder(TreeNode *treePtr, Function& visit) const;
+
+    /** Traverses the items of a threaded binary search tree whose ranks lie
+     *  in a given range. Run on a worker thread by parallelInorderTraverse().
+     * @param first  The rank of the first item to visit.
+     * @param last  One past the rank of the last item to visit.
+     * @param visit  An object callable as visit(const Key&, const Value&).
+     * @param error  A container for anything visit throws.
+     * @pre 0 <= first <= last <= getLength().
+     * @post visit has been called once for each item in the range, in sorted
+     *       order, unless it threw; error then holds what it threw.
+     */
+    template <class Function>
+    void inorderRange(int first, int last, Function& visit,
+                      exception_ptr& error) const;
     
     /** Locates the leftmost node in a subtree to connect its left thread
      *  pointer to a new predecessor. Called by deleteNodeItem().
@@ -407,8 +820,8 @@ protected:
      * @post The left thread pointer of this node points to the predecessor of
      *       its inorder predecessor; may be NULL.
      */
-    void passPredecessor(ThreadedTreeNode *& nodePtr,
-                         ThreadedTreeNode *newPredecessor);
+    void passPredecessor(TreeNode *& nodePtr,
+                         TreeNode *newPredecessor);
     
     /** Locates the leftmost node in a subtree to connect its left thread
      *  pointer to a new successor. Called by deleteNodeItem().
@@ -421,14 +834,42 @@ protected:
      * @post The right thread pointer of this node points to the successor of
      *       its inorder successor; may be NULL.
      */
-    void passSuccessor(ThreadedTreeNode *& nodePtr,
-                       ThreadedTreeNode *newSuccessor);
+    void passSuccessor(TreeNode *& nodePtr,
+                       TreeNode *newSuccessor);
+
+    Compare   compare;      // ordering of search keys
 
 private:
 
-    ThreadedTreeNode *root;     // Pointer to root of tree
+    /** Hands each item to a function object as read-only, for traversals of
+     *  a const tree.
+     */
+    template <class Function>
+    class ConstVisitor
+    {
+    public:
+
+        explicit ConstVisitor(Function& aVisit) : visit(aVisit)
+        {
+        } // end constructor
+
+        void operator()(const Key& aKey, const Value& aValue)
+        {
+            visit(aKey, aValue);
+        } // end operator()(Key&, Value&)
+
+    private:
+
+        Function& visit;        // object that sees every item
+
+    }; // end ConstVisitor
+
+    TreeNode           *root;   // Pointer to root of tree
+    NodePool<TreeNode>  pool;   // storage for the nodes of this tree
 
 }; // end ThreadedBST
 
 
+#include "ThreadedBST.cpp"
+
 #endif	/* _THREADEDBST_H */
@@ -5,23 +5,47 @@
  *              & Problem Solving with C++: Walls and Mirrors" (5th ed.) pp.
  *              555-556. Boston, MA: Pearson Education, Inc.
  * @brief   A pointer-based tree node with an added data member to indicate if
- *          the child pointers are actually thread pointers.
+ *          the child pointers are actually thread pointers. Being a template,
+ *          this file is included by ThreadedTreeNode.h rather than compiled on
+ *          its own.
  * @author  Brendan Sweeney, SID 1161836
  * @date    December 8, 2011
  */
 
+#ifndef _THREADEDTREENODE_CPP
+#define	_THREADEDTREENODE_CPP
+
+#include <utility>          // for move
+
 #include "ThreadedTreeNode.h"
 
 using namespace std;
 
 
-ThreadedTreeNode::ThreadedTreeNode()
+template <class Key, class Value>
+ThreadedTreeNode<Key, Value>::ThreadedTreeNode() : balance(0), count(1)
 {
 } // end default constructor
 
-ThreadedTreeNode::ThreadedTreeNode(const TreeItemType& nodeItem,
-                                         ThreadedTreeNode *left,
-                                         ThreadedTreeNode *right) :
-  item(nodeItem), leftChildPtr(left), rightChildPtr(right), threads(BOTHTHREAD)
+template <class Key, class Value>
+ThreadedTreeNode<Key, Value>::ThreadedTreeNode(const Key& nodeKey,
+                                               const Value& nodeValue,
+                                               ThreadedTreeNode *left,
+                                               ThreadedTreeNode *right) :
+  key(nodeKey), value(nodeValue), threads(BOTHTHREAD), balance(0), count(1),
+  leftChildPtr(left), rightChildPtr(right)
 {
 } // end constructor
+
+template <class Key, class Value>
+ThreadedTreeNode<Key, Value>::ThreadedTreeNode(Key&& nodeKey,
+                                               Value&& nodeValue,
+                                               ThreadedTreeNode *left,
+                                               ThreadedTreeNode *right) :
+  key(move(nodeKey)), value(move(nodeValue)), threads(BOTHTHREAD), balance(0),
+  count(1), leftChildPtr(left), rightChildPtr(right)
+{
+} // end constructor (Key&&, Value&&)
+
+
+#endif	/* _THREADEDTREENODE_CPP */
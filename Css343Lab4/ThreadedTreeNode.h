@@ -5,7 +5,9 @@
  *              & Problem Solving with C++: Walls and Mirrors" (5th ed.) p.
  *              518. Boston, MA: Pearson Education, Inc.
  * @brief   A pointer-based tree node with an added data member to indicate if
- *          the child pointers are actually thread pointers.
+ *          the child pointers are actually thread pointers. The node holds its
+ *          search key and value directly, so the tree never has to ask an item
+ *          for a copy of its key in order to compare it.
  * @author  Brendan Sweeney, SID 1161836
  * @date    December 8, 2011
  */
@@ -13,31 +15,42 @@
 #ifndef _THREADEDTREENODE_H
 #define	_THREADEDTREENODE_H
 
-#include "KeyedItem.h"
-
 using namespace std;
 
 
-typedef KeyedItem TreeItemType;
 enum {NOTHREAD = 0, LEFTTHREAD = 1, RIGHTTHREAD = 2, BOTHTHREAD = 3};
 
+template <class Key, class Value, class Compare> class ThreadedBST;
+template <class Key, class Value, class Compare> class AVLThreadedBST;
+
+template <class Key, class Value>
 class ThreadedTreeNode
 {
 private:
 
     ThreadedTreeNode();
 
-    ThreadedTreeNode(const TreeItemType& nodeItem,
+    ThreadedTreeNode(const Key& nodeKey, const Value& nodeValue,
+                           ThreadedTreeNode *left,
+                           ThreadedTreeNode *right);
+
+    ThreadedTreeNode(Key&& nodeKey, Value&& nodeValue,
                            ThreadedTreeNode *left,
                            ThreadedTreeNode *right);
 
-    TreeItemType      item;             // data portion
+    Key               key;              // search key
+    Value             value;            // data portion
     int               threads;          // thread position indicator
+    int               balance;          // right height minus left height
+    int               count;            // nodes in subtree rooted here
     ThreadedTreeNode *leftChildPtr;     // pointer to left child
     ThreadedTreeNode *rightChildPtr;    // pointer to right child
 
-    friend class ThreadedBST;
+    template <class K, class V, class C> friend class ThreadedBST;
+    template <class K, class V, class C> friend class AVLThreadedBST;
 }; // end ThreadedTreeNode
 
 
+#include "ThreadedTreeNode.cpp"
+
 #endif	/* _THREADEDTREENODE_H */
@@ -0,0 +1,381 @@
+/*
+ * @file    TitleIndex.cpp
+ * @brief   An inverted index from the words of movie titles to the movies
+ *          whose titles contain them. A word is a run of letters and digits,
+ *          folded to lower case; apostrophes are dropped and any other
+ *          character ends a word. Each word leads to a posting list of the
+ *          search keys of its movies, kept sorted, so the lists of several
+ *          words are intersected by stepping through them together rather
+ *          than by comparing every pair. A search finds the movies whose
+ *          titles contain every word typed; the last word may be cut short,
+ *          as when a title is still being typed.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <new>
+#include "TitleIndex.h"
+
+
+TitleIndex::TitleIndex()
+{
+} // end Default Constructor
+
+TitleIndex::~TitleIndex()
+{
+} // end Destructor
+
+bool TitleIndex::addTitle(const string& title, const ItemKey& movie,
+                          const string& keptTitle)
+{
+    vector<string> words;
+    vector<string> keptWords;
+    size_t         entered = 0;
+
+    try
+    {
+        splitWords(title, words);
+        splitWords(keptTitle, keptWords);
+
+        for (; entered < words.size(); ++entered)
+        {
+            if (!binary_search(keptWords.begin(), keptWords.end(),
+                               words[entered]))
+            {
+                enterWord(words[entered], movie);
+            } // end if (!binary_search(...))
+        } // end for (; entered < words.size(); ++entered)
+    }
+    catch (bad_alloc e)
+    {
+        return false;
+    }
+    catch (TreeException e)
+    {
+        // take back the words entered before the one that failed
+        for (size_t i = 0; i < entered; ++i)
+        {
+            if (!binary_search(keptWords.begin(), keptWords.end(), words[i]))
+            {
+                eraseWord(words[i], movie);
+            } // end if (!binary_search(...))
+        } // end for (i < entered)
+
+        return false;
+    } // end try
+
+    return true;
+} // end addTitle(string&, ItemKey&, string&)
+
+bool TitleIndex::addTitles(const vector<pair<string, ItemKey> >& movies)
+{
+    vector<Posting> entries;        // every word of every title
+    vector<string>  words;
+    size_t          first = 0;      // first entry of the word being merged
+    size_t          last = 0;       // one past its last entry
+
+    try
+    {
+        for (size_t i = 0; i < movies.size(); ++i)
+        {
+            splitWords(movies[i].first, words);
+
+            for (size_t j = 0; j < words.size(); ++j)
+            {
+                entries.push_back(Posting(words[j], movies[i].second));
+            } // end for (j < words.size())
+        } // end for (i < movies.size())
+
+        sort(entries.begin(), entries.end());   // by word, then by movie
+
+        for (; first < entries.size(); first = last)
+        {
+            PostingList  additions;
+            PostingList *list = postings.findMutable(entries[first].first);
+
+            for (last = first; last < entries.size() &&
+                 entries[last].first == entries[first].first; ++last)
+            {
+                additions.push_back(entries[last].second);
+            } // end for (last < entries.size())
+
+            if (list == NULL)
+            {
+                postings.searchTreeInsert(string(entries[first].first),
+                                          move(additions));
+            }
+            else
+            {
+                // both parts are sorted, so one merge keeps the whole sorted
+                size_t oldQty = list->size();
+
+                list->insert(list->end(), additions.begin(), additions.end());
+                inplace_merge(list->begin(), list->begin() + oldQty,
+                              list->end());
+            } // end if (list == NULL)
+        } // end for (; first < entries.size(); first = last)
+    }
+    catch (bad_alloc e)
+    {
+        // take back the words merged before the one that failed
+        for (size_t i = 0; i < first; ++i)
+        {
+            eraseWord(entries[i].first, entries[i].second);
+        } // end for (i < first)
+
+        return false;
+    }
+    catch (TreeException e)
+    {
+        for (size_t i = 0; i < first; ++i)
+        {
+            eraseWord(entries[i].first, entries[i].second);
+        } // end for (i < first)
+
+        return false;
+    } // end try
+
+    return true;
+} // end addTitles(vector<pair<string, ItemKey> >&)
+
+void TitleIndex::removeTitle(const string& title, const ItemKey& movie,
+                             const string& keptTitle)
+{
+    vector<string> words;
+    vector<string> keptWords;
+
+    splitWords(title, words);
+    splitWords(keptTitle, keptWords);
+
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+        if (!binary_search(keptWords.begin(), keptWords.end(), words[i]))
+        {
+            eraseWord(words[i], movie);
+        } // end if (!binary_search(...))
+    } // end for (i < words.size())
+} // end removeTitle(string&, ItemKey&, string&)
+
+int TitleIndex::findTitles(const string& words,
+                           vector<ItemKey>& movies) const
+{
+    vector<string>             wholeWords;
+    vector<string>             lastWord;
+    vector<const PostingList*> lists;
+    PostingList                found;
+    size_t                     cut = words.size();
+
+    // a search still being typed ends in the middle of its last word
+    while (cut > 0 && isWordChar(words[cut - 1]))
+    {
+        --cut;
+    } // end while (cut > 0 && isWordChar(words[cut - 1]))
+
+    splitWords(words.substr(0, cut), wholeWords);
+    splitWords(words.substr(cut), lastWord);
+
+    if (wholeWords.empty() && lastWord.empty())
+    {
+        return 0;
+    } // end if (wholeWords.empty() && lastWord.empty())
+
+    for (size_t i = 0; i < wholeWords.size(); ++i)
+    {
+        pair<AVLThreadedBST<string, PostingList>::Inorder,
+             AVLThreadedBST<string, PostingList>::Inorder>
+            range(postings.equalRange(wholeWords[i]));
+
+        if (range.first == range.second)
+        {
+            return 0;                   // no title has this word
+        } // end if (range.first == range.second)
+
+        lists.push_back(&*range.first);
+    } // end for (i < wholeWords.size())
+
+    // start from the shortest list, so each step has the fewest to check
+    for (size_t i = 1; i < lists.size(); ++i)
+    {
+        if (lists[i]->size() < lists[0]->size())
+        {
+            swap(lists[0], lists[i]);
+        } // end if (lists[i]->size() < lists[0]->size())
+    } // end for (i < lists.size())
+
+    if (!lastWord.empty())
+    {
+        collectPrefix(lastWord[0], found);
+
+        for (size_t i = 0; i < lists.size() && !found.empty(); ++i)
+        {
+            intersect(found, *lists[i]);
+        } // end for (i < lists.size() && !found.empty())
+    }
+    else
+    {
+        found = *lists[0];
+
+        for (size_t i = 1; i < lists.size() && !found.empty(); ++i)
+        {
+            intersect(found, *lists[i]);
+        } // end for (i < lists.size() && !found.empty())
+    } // end if (!lastWord.empty())
+
+    movies.insert(movies.end(), found.begin(), found.end());
+    return int(found.size());
+} // end findTitles(string&, vector<ItemKey>&)
+
+int TitleIndex::getWordQty(void) const
+{
+    return postings.getLength();
+} // end getWordQty()
+
+void TitleIndex::clear(void)
+{
+    postings = AVLThreadedBST<string, PostingList>();
+} // end clear()
+
+void TitleIndex::splitWords(const string& text, vector<string>& words)
+{
+    string word;
+
+    words.clear();
+
+    for (size_t i = 0; i <= text.size(); ++i)
+    {
+        char aChar = (i < text.size() ? text[i] : ' ');
+
+        if (aChar == '\'')
+        {
+            continue;                   // "Tiffany's" is one word
+        }
+        else if (isWordChar(aChar))
+        {
+            word += char(tolower(static_cast<unsigned char>(aChar)));
+        }
+        else if (!word.empty())
+        {
+            words.push_back(word);
+            word.clear();
+        } // end if (aChar == '\'')
+    } // end for (i <= text.size())
+
+    sort(words.begin(), words.end());
+    words.erase(unique(words.begin(), words.end()), words.end());
+} // end splitWords(string&, vector<string>&)
+
+bool TitleIndex::isWordChar(char aChar)
+{
+    return isalnum(static_cast<unsigned char>(aChar)) || aChar == '\'';
+} // end isWordChar(char)
+
+void TitleIndex::enterWord(const string& word, const ItemKey& movie)
+     throw(TreeException)
+{
+    PostingList *list = postings.findMutable(word);
+
+    try
+    {
+        if (list == NULL)
+        {
+            postings.searchTreeInsert(word, PostingList(1, movie));
+        }
+        else
+        {
+            PostingList::iterator place = lower_bound(list->begin(),
+                                                      list->end(), movie);
+
+            if (place == list->end() || movie < *place)
+            {
+                list->insert(place, movie);
+            } // end if (place == list->end() || movie < *place)
+        } // end if (list == NULL)
+    }
+    catch (bad_alloc e)
+    {
+        throw TreeException(
+                "TreeException: title index cannot allocate memory");
+    } // end try
+} // end enterWord(string&, ItemKey&)
+
+void TitleIndex::eraseWord(const string& word, const ItemKey& movie)
+{
+    PostingList *list = postings.findMutable(word);
+
+    if (list == NULL)
+    {
+        return;
+    } // end if (list == NULL)
+
+    PostingList::iterator place = lower_bound(list->begin(), list->end(),
+                                              movie);
+
+    if (place != list->end() && !(movie < *place))
+    {
+        list->erase(place);
+    } // end if (place != list->end() && !(movie < *place))
+
+    if (list->empty())
+    {
+        postings.searchTreeDelete(word);    // found just above
+    } // end if (list->empty())
+} // end eraseWord(string&, ItemKey&)
+
+void TitleIndex::collectPrefix(const string& prefix,
+                               PostingList& movies) const
+{
+    // words hold only letters and digits, so bumping the last character
+    // gives the first string past every word that begins with prefix
+    string limit(prefix);
+    ++limit[limit.size() - 1];
+
+    AVLThreadedBST<string, PostingList>::Inorder
+        entry(postings.lowerBound(prefix));
+    AVLThreadedBST<string, PostingList>::Inorder
+        stop(postings.lowerBound(limit));
+
+    movies.clear();
+
+    for (; entry != stop; ++entry)
+    {
+        // a movie may have several words that begin with prefix
+        PostingList merged;
+
+        merged.reserve(movies.size() + (*entry).size());
+        set_union(movies.begin(), movies.end(), (*entry).begin(),
+                  (*entry).end(), back_inserter(merged));
+        movies.swap(merged);
+    } // end for (; entry != stop; ++entry)
+} // end collectPrefix(string&, PostingList&)
+
+void TitleIndex::intersect(PostingList& movies, const PostingList& list)
+{
+    PostingList::const_iterator from = list.begin();
+    bool   leap = list.size() > 8 * movies.size();  // binary search instead
+    size_t kept = 0;
+
+    for (size_t i = 0; i < movies.size() && from != list.end(); ++i)
+    {
+        if (leap)
+        {
+            from = lower_bound(from, list.end(), movies[i]);
+        }
+        else
+        {
+            while (from != list.end() && *from < movies[i])
+            {
+                ++from;
+            } // end while (from != list.end() && *from < movies[i])
+        } // end if (leap)
+
+        if (from != list.end() && !(movies[i] < *from))
+        {
+            movies[kept++] = movies[i];
+        } // end if (from != list.end() && !(movies[i] < *from))
+    } // end for (i < movies.size() && from != list.end())
+
+    movies.erase(movies.begin() + kept, movies.end());
+} // end intersect(PostingList&, PostingList&)
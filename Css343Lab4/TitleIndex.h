@@ -0,0 +1,188 @@
+/*
+ * @file    TitleIndex.h
+ * @brief   An inverted index from the words of movie titles to the movies
+ *          whose titles contain them. A word is a run of letters and digits,
+ *          folded to lower case; apostrophes are dropped and any other
+ *          character ends a word. Each word leads to a posting list of the
+ *          search keys of its movies, kept sorted, so the lists of several
+ *          words are intersected by stepping through them together rather
+ *          than by comparing every pair. A search finds the movies whose
+ *          titles contain every word typed; the last word may be cut short,
+ *          as when a title is still being typed.
+ * @author  Brendan Sweeney, SID 1161836
+ * @date    October 17, 2026
+ */
+
+#ifndef _TITLEINDEX_H
+#define	_TITLEINDEX_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "AVLThreadedBST.h"
+#include "ItemKey.h"
+
+using namespace std;
+
+
+class TitleIndex
+{
+public:
+
+/**---------------------- Default Constructor ---------------------------------
+ * Creates an empty TitleIndex.
+ * @pre None.
+ * @post An empty TitleIndex exists.
+ */
+    TitleIndex();
+
+/**---------------------- Destructor ------------------------------------------
+ * Deletes every posting list of this TitleIndex.
+ * @pre None.
+ * @post This TitleIndex is empty.
+ */
+    virtual ~TitleIndex();
+
+/**---------------------- addTitle() ------------------------------------------
+ * Enters the words of a title for a movie, leaving out any that are also in a
+ * title already entered for it. Either every word is entered or none is.
+ * @param title  The title whose words are entered.
+ * @param movie  The search key of the movie.
+ * @param keptTitle  A title already entered for movie, or an empty string.
+ * @pre None.
+ * @post Each word of title that is not in keptTitle leads to movie, if this
+ *       returned true; otherwise this TitleIndex is unchanged.
+ * @return true if every word was entered; false, otherwise.
+ */
+    bool addTitle(const string& title, const ItemKey& movie,
+                  const string& keptTitle);
+
+/**---------------------- addTitles() -----------------------------------------
+ * Enters the titles of a batch of movies at once. The words of the batch are
+ * sorted together, so that each posting list is found once and merged with
+ * its new entries in one pass. Either every title is entered or none is.
+ * @param movies  The title and search key of each movie; no movie is
+ *                entered already.
+ * @pre None.
+ * @post Each word of each title leads to its movie, if this returned true;
+ *       otherwise this TitleIndex is unchanged.
+ * @return true if every title was entered; false, otherwise.
+ */
+    bool addTitles(const vector<pair<string, ItemKey> >& movies);
+
+/**---------------------- removeTitle() ---------------------------------------
+ * Removes the words of a title for a movie, keeping any that are also in a
+ * title that stays entered for it.
+ * @param title  The title whose words are removed.
+ * @param movie  The search key of the movie.
+ * @param keptTitle  A title that stays entered for movie, or an empty string.
+ * @pre None.
+ * @post No word of title that is not in keptTitle leads to movie.
+ */
+    void removeTitle(const string& title, const ItemKey& movie,
+                     const string& keptTitle);
+
+/**---------------------- findTitles() ----------------------------------------
+ * Finds the movies whose titles contain every word of a search. If the search
+ * does not end with a space or punctuation, its last word matches any word
+ * that begins with it.
+ * @param words  The words to search for, as typed.
+ * @param movies  A container to which the search keys of the movies are
+ *                appended.
+ * @pre None.
+ * @post movies ends with the search key of each matching movie, in order of
+ *       search key.
+ * @return The number of movies appended; 0 if words has no word in it.
+ */
+    int findTitles(const string& words, vector<ItemKey>& movies) const;
+
+/**---------------------- getWordQty() ----------------------------------------
+ * Counts the distinct words entered in this TitleIndex.
+ * @pre None.
+ * @post None.
+ * @return The number of words that lead to at least one movie.
+ */
+    int getWordQty(void) const;
+
+/**---------------------- clear() ---------------------------------------------
+ * Removes every word from this TitleIndex.
+ * @pre None.
+ * @post This TitleIndex is empty.
+ */
+    void clear(void);
+
+private:
+
+    typedef vector<ItemKey> PostingList;    // search keys, in sorted order
+    typedef pair<string, ItemKey> Posting;  // one word of one title
+
+    AVLThreadedBST<string, PostingList> postings;   // posting list of a word
+
+/**---------------------- splitWords() ----------------------------------------
+ * Breaks a text into its distinct words.
+ * @param text  The text to break up.
+ * @param words  A container for the words.
+ * @pre None.
+ * @post words holds each word of text once, folded to lower case and in
+ *       sorted order.
+ */
+    static void splitWords(const string& text, vector<string>& words);
+
+/**---------------------- isWordChar() ----------------------------------------
+ * Determines whether a character belongs to a word.
+ * @param aChar  The character.
+ * @pre None.
+ * @post None.
+ * @return true if aChar is a letter, a digit or an apostrophe; false,
+ *         otherwise.
+ */
+    static bool isWordChar(char aChar);
+
+/**---------------------- enterWord() -----------------------------------------
+ * Adds a movie to the posting list of a word, starting the list if the word
+ * is new.
+ * @param word  The word.
+ * @param movie  The search key of the movie.
+ * @pre movie is not in the posting list of word.
+ * @post movie is in the posting list of word.
+ * @throw TreeException  If memory allocation fails; the posting lists are
+ *        unchanged.
+ */
+    void enterWord(const string& word, const ItemKey& movie)
+         throw(TreeException);
+
+/**---------------------- eraseWord() -----------------------------------------
+ * Removes a movie from the posting list of a word, and the word itself if no
+ * movie is left.
+ * @param word  The word.
+ * @param movie  The search key of the movie.
+ * @pre None.
+ * @post movie is not in the posting list of word.
+ */
+    void eraseWord(const string& word, const ItemKey& movie);
+
+/**---------------------- collectPrefix() -------------------------------------
+ * Gathers the movies of every word that begins with a prefix.
+ * @param prefix  The start of the words to gather.
+ * @param movies  A container for the search keys of the movies.
+ * @pre None.
+ * @post movies holds each movie of each word beginning with prefix, once and
+ *       in sorted order.
+ */
+    void collectPrefix(const string& prefix, PostingList& movies) const;
+
+/**---------------------- intersect() -----------------------------------------
+ * Keeps only the movies that are also in a posting list. When the list is
+ * much longer than the movies kept so far, each movie is looked for by binary
+ * search from where the last one was found, rather than by stepping through
+ * every entry of the list.
+ * @param movies  The movies kept so far, in sorted order.
+ * @param list  The posting list to intersect with.
+ * @pre None.
+ * @post movies holds, in sorted order, the movies that were in both.
+ */
+    static void intersect(PostingList& movies, const PostingList& list);
+
+}; // end class TitleIndex
+
+#endif	/* _TITLEINDEX_H */
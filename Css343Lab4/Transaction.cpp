@@ -25,6 +25,13 @@ Transaction::Transaction(Merch *newItem) :
     } // end if (newItem != NULL)
 } // end Constructor
 
+Transaction::Transaction(Transaction&& orig) :
+                    item(orig.item), mediaCode(orig.mediaCode),
+                    custID(orig.custID)
+{
+    orig.item = NULL;       // item now belongs to this Transaction
+} // end Move Constructor
+
 Transaction::~Transaction()
 {
     if (item != NULL)       // item must be destroyed
@@ -44,6 +51,11 @@ Merch* Transaction::getItem(void) const
     return item->copy();
 } // end getItem()
 
+const Merch* Transaction::peekItem(void) const
+{
+    return item;
+} // end peekItem()
+
 void Transaction::setItem(const Merch *newItem)
 {
     if (item != NULL)       // current item must be destroyed
@@ -58,6 +70,16 @@ void Transaction::setItem(const Merch *newItem)
     } // end if (newItem != NULL)
 } // end setItem(Merch*)
 
+void Transaction::adoptItem(Merch *newItem)
+{
+    if (item != newItem)    // current item must be destroyed
+    {
+        delete item;
+    } // end if (item != newItem)
+
+    item = newItem;
+} // end adoptItem(Merch*)
+
 char Transaction::getMediaCode(void) const
 {
     return mediaCode;
@@ -48,6 +48,16 @@ public:
  */
     //Transaction(const Transaction& orig);
 
+/**---------------------- Move Constructor ------------------------------------
+ * Creates a Transaction object that takes over the merchandise of another
+ * Transaction, without copying it.
+ * @param orig  The original Transaction, whose merchandise is taken.
+ * @pre None.
+ * @post A Transaction object exists with the merchandise, media code and
+ *       customer ID orig had; orig holds no merchandise.
+ */
+    Transaction(Transaction&& orig);
+
 /**---------------------- Destructor ------------------------------------------
  * @pre None.
  * @post This Transaction object has been cleanly deleted.
@@ -109,6 +119,15 @@ public:
  */
     Merch* getItem(void) const;
 
+/**---------------------- peekItem() ------------------------------------------
+ * Retrieves the Merchandise item of this Transaction without copying it.
+ * @pre None.
+ * @post None.
+ * @return The item this Transaction holds, or NULL if it holds none. It is
+ *         still owned by this Transaction and must not be deleted.
+ */
+    const Merch* peekItem(void) const;
+
 /**---------------------- setItem() -------------------------------------------
  * Sets the Merchandise item of this Transaction.
  * @param newItem  The new Merchandise item for this Transaction.
@@ -117,6 +136,15 @@ public:
  */
     void setItem(const Merch *newItem);
 
+/**---------------------- adoptItem() -----------------------------------------
+ * Sets the Merchandise item of this Transaction, taking ownership of it rather
+ * than copying it.
+ * @param newItem  The new Merchandise item for this Transaction.
+ * @pre newItem was allocated with new and is not owned by anything else.
+ * @post This Transaction owns newItem and will delete it.
+ */
+    void adoptItem(Merch *newItem);
+
 /**---------------------- getMediaCode() --------------------------------------
  * Retrieves the character representing a type of media from this Transaction.
  * @pre None.